@@ -0,0 +1,117 @@
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <fmt/core.h>
+
+namespace fintamath::benchmarks {
+
+namespace {
+
+std::chrono::nanoseconds percentile(const std::vector<std::chrono::nanoseconds> &sortedLatencies, size_t percent) {
+  if (sortedLatencies.empty()) {
+    return {};
+  }
+
+  const size_t index = (sortedLatencies.size() - 1) * percent / 100;
+  return sortedLatencies[index];
+}
+
+double toMicroseconds(std::chrono::nanoseconds time) {
+  return std::chrono::duration<double, std::micro>(time).count();
+}
+
+std::string escapeJson(const std::string &str) {
+  std::string res;
+
+  for (const char ch : str) {
+    if (ch == '"' || ch == '\\') {
+      res += '\\';
+    }
+
+    res += ch;
+  }
+
+  return res;
+}
+
+}
+
+PhaseResult makePhaseResult(std::string name, size_t inputs, size_t skippedInputs, std::vector<std::chrono::nanoseconds> latencies) {
+  PhaseResult res;
+  res.name = std::move(name);
+  res.inputs = inputs;
+  res.skippedInputs = skippedInputs;
+  res.operations = latencies.size();
+
+  if (latencies.empty()) {
+    return res;
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+
+  res.total = std::accumulate(latencies.begin(), latencies.end(), std::chrono::nanoseconds{});
+  res.mean = res.total / static_cast<std::chrono::nanoseconds::rep>(latencies.size());
+  res.median = percentile(latencies, 50);
+  res.p90 = percentile(latencies, 90);
+  res.p99 = percentile(latencies, 99);
+  res.max = latencies.back();
+  res.throughput = static_cast<double>(res.operations) / std::chrono::duration<double>(res.total).count();
+
+  return res;
+}
+
+std::string toText(const std::vector<PhaseResult> &results) {
+  std::string res = fmt::format("{:<16} {:>8} {:>8} {:>12} {:>12} {:>12} {:>12} {:>12} {:>14}\n",
+                                "phase", "inputs", "skipped", "mean, us", "median, us", "p90, us", "p99, us", "max, us", "ops/s");
+
+  for (const auto &result : results) {
+    res += fmt::format("{:<16} {:>8} {:>8} {:>12.2f} {:>12.2f} {:>12.2f} {:>12.2f} {:>12.2f} {:>14.2f}\n",
+                       result.name,
+                       result.inputs,
+                       result.skippedInputs,
+                       toMicroseconds(result.mean),
+                       toMicroseconds(result.median),
+                       toMicroseconds(result.p90),
+                       toMicroseconds(result.p99),
+                       toMicroseconds(result.max),
+                       result.throughput);
+  }
+
+  return res;
+}
+
+std::string toJson(const std::vector<PhaseResult> &results) {
+  std::string res = "{\n  \"phases\": [";
+
+  for (size_t i = 0; i < results.size(); i++) {
+    const PhaseResult &result = results[i];
+
+    res += i == 0 ? "\n" : ",\n";
+    res += fmt::format(
+        "    {{\"name\": \"{}\", \"inputs\": {}, \"skipped_inputs\": {}, \"operations\": {}, "
+        "\"total_ns\": {}, \"mean_ns\": {}, \"median_ns\": {}, \"p90_ns\": {}, \"p99_ns\": {}, \"max_ns\": {}, "
+        "\"throughput_ops_per_s\": {:.3f}}}",
+        escapeJson(result.name),
+        result.inputs,
+        result.skippedInputs,
+        result.operations,
+        result.total.count(),
+        result.mean.count(),
+        result.median.count(),
+        result.p90.count(),
+        result.p99.count(),
+        result.max.count(),
+        result.throughput);
+  }
+
+  res += "\n  ]\n}\n";
+  return res;
+}
+
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace fintamath::benchmarks {
+
+struct PhaseResult {
+  std::string name;
+
+  size_t inputs = 0;
+
+  size_t skippedInputs = 0;
+
+  size_t operations = 0;
+
+  std::chrono::nanoseconds total{};
+
+  std::chrono::nanoseconds mean{};
+
+  std::chrono::nanoseconds median{};
+
+  std::chrono::nanoseconds p90{};
+
+  std::chrono::nanoseconds p99{};
+
+  std::chrono::nanoseconds max{};
+
+  double throughput = 0;
+};
+
+template <typename Input>
+using PhaseFunction = std::function<void(const Input &)>;
+
+PhaseResult makePhaseResult(std::string name, size_t inputs, size_t skippedInputs, std::vector<std::chrono::nanoseconds> latencies);
+
+std::string toText(const std::vector<PhaseResult> &results);
+
+std::string toJson(const std::vector<PhaseResult> &results);
+
+// Run func once per input to skip the inputs that throw, then measure every remaining input repetitions times.
+template <typename Input>
+PhaseResult runPhase(std::string name, const std::vector<Input> &inputs, const PhaseFunction<Input> &func, size_t repetitions) {
+  std::vector<const Input *> validInputs;
+
+  for (const auto &input : inputs) {
+    try {
+      func(input);
+      validInputs.emplace_back(&input);
+    }
+    catch (...) {
+      // Inputs that are expected to throw are not representative
+    }
+  }
+
+  std::vector<std::chrono::nanoseconds> latencies;
+  latencies.reserve(validInputs.size() * repetitions);
+
+  for (size_t i = 0; i < repetitions; i++) {
+    for (const Input *input : validInputs) {
+      const auto start = std::chrono::steady_clock::now();
+      func(*input);
+      const auto end = std::chrono::steady_clock::now();
+
+      latencies.emplace_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start));
+    }
+  }
+
+  return makePhaseResult(std::move(name), inputs.size(), inputs.size() - validInputs.size(), std::move(latencies));
+}
+
+}
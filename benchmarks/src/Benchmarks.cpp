@@ -0,0 +1,270 @@
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include "fintamath/core/IArithmetic.hpp"
+#include "fintamath/core/IComparable.hpp"
+#include "fintamath/core/IMathObject.hpp"
+#include "fintamath/core/MathObjectClass.hpp"
+#include "fintamath/core/MathObjectUtils.hpp"
+#include "fintamath/expressions/Expression.hpp"
+#include "fintamath/expressions/ExpressionFunctions.hpp"
+#include "fintamath/expressions/SimplifyCache.hpp"
+#include "fintamath/functions/IFunction.hpp"
+#include "fintamath/functions/IOperator.hpp"
+#include "fintamath/literals/ILiteral.hpp"
+#include "fintamath/literals/Variable.hpp"
+#include "fintamath/literals/constants/IConstant.hpp"
+#include "fintamath/numbers/INumber.hpp"
+#include "fintamath/numbers/Integer.hpp"
+#include "fintamath/numbers/Rational.hpp"
+
+#include "Benchmark.hpp"
+#include "Corpus.hpp"
+
+using namespace fintamath;
+using namespace fintamath::benchmarks;
+
+namespace {
+
+struct Options {
+  std::string corpusDir = FINTAMATH_BENCHMARKS_CORPUS_DIR;
+
+  std::string jsonPath;
+
+  size_t repetitions = 3;
+
+  size_t simplifyCacheCapacity = 0;
+
+  std::set<std::string, std::less<>> phases;
+};
+
+constexpr std::string_view usage =
+    "Usage: fintamath_benchmarks [options]\n"
+    "  --corpus <dir>        directory with simplify, approximate and solve test suites\n"
+    "  --repetitions <n>     number of measured runs per input (default: 3)\n"
+    "  --phase <name>        run only the given phase, can be repeated\n"
+    "                        (parse, toString, approximate, approximateAdaptive, derivative, solve, is,\n"
+    "                        isChainWalk)\n"
+    "  --simplify-cache <n>  enable simplify cache with the given capacity (default: 0)\n"
+    "  --json <file>         write results in JSON, use - for stdout\n";
+
+Options parseOptions(int argc, char *argv[]) {
+  Options options;
+
+  for (int i = 1; i < argc; i++) {
+    const std::string_view arg = argv[i];
+
+    if (arg == "--help") {
+      std::cout << usage;
+      std::exit(0);
+    }
+
+    if (i + 1 >= argc) {
+      throw std::invalid_argument(fmt::format(R"(Unknown or incomplete option "{}")", arg));
+    }
+
+    const std::string value = argv[++i];
+
+    if (arg == "--corpus") {
+      options.corpusDir = value;
+    }
+    else if (arg == "--repetitions") {
+      options.repetitions = std::stoul(value);
+    }
+    else if (arg == "--phase") {
+      options.phases.emplace(value);
+    }
+    else if (arg == "--simplify-cache") {
+      options.simplifyCacheCapacity = std::stoul(value);
+    }
+    else if (arg == "--json") {
+      options.jsonPath = value;
+    }
+    else {
+      throw std::invalid_argument(fmt::format(R"(Unknown option "{}")", arg));
+    }
+  }
+
+  return options;
+}
+
+void collectClasses(const IMathObject &obj, std::vector<MathObjectClass> &classes) {
+  classes.emplace_back(obj.getClass());
+
+  if (const auto *expr = cast<IExpression>(&obj)) {
+    // Expression itself has no function
+    if (const auto &func = expr->getFunction()) {
+      classes.emplace_back(func->getClass());
+    }
+
+    for (const auto &child : expr->getChildren()) {
+      collectClasses(*child, classes);
+    }
+  }
+}
+
+std::vector<std::vector<MathObjectClass>> collectClasses(const std::vector<Expression> &exprs) {
+  std::vector<std::vector<MathObjectClass>> classesVect;
+
+  for (const auto &expr : exprs) {
+    collectClasses(expr, classesVect.emplace_back());
+  }
+
+  return classesVect;
+}
+
+// Subtype check without the interval numbering, kept to compare against
+bool isChainWalk(const MathObjectClass to, const MathObjectClass from) noexcept {
+  for (MathObjectClass parent = from; parent; parent = parent->getParent()) {
+    if (parent == to) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+std::vector<Expression> parseAll(const std::vector<std::string> &strs) {
+  std::vector<Expression> exprs;
+
+  for (const auto &str : strs) {
+    try {
+      exprs.emplace_back(str);
+    }
+    catch (const std::exception &) {
+      // Invalid inputs are skipped
+    }
+  }
+
+  return exprs;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+  try {
+    const Options options = parseOptions(argc, argv);
+    const Corpus corpus = loadCorpus(options.corpusDir);
+
+    SimplifyCache::setCapacity(options.simplifyCacheCapacity);
+
+    std::vector<std::string> allStrs = corpus.simplify;
+    allStrs.insert(allStrs.end(), corpus.approximate.begin(), corpus.approximate.end());
+    allStrs.insert(allStrs.end(), corpus.solve.begin(), corpus.solve.end());
+
+    const std::vector<Expression> allExprs = parseAll(allStrs);
+    const std::vector<Expression> simplifyExprs = parseAll(corpus.simplify);
+    const std::vector<Expression> approximateExprs = parseAll(corpus.approximate);
+    const std::vector<Expression> solveExprs = parseAll(corpus.solve);
+    const Expression var("x");
+
+    const auto isSelected = [&options](std::string_view phase) {
+      return options.phases.empty() || options.phases.contains(phase);
+    };
+
+    const auto parseFunc = [](const std::string &str) { Expression expr(str); };
+    const auto toStringFunc = [](const Expression &expr) { (void)expr.toString(); };
+    const auto approximateFunc = [](const Expression &expr) { (void)approximate(expr); };
+    const auto approximateAdaptiveFunc = [](const Expression &expr) { (void)approximateAdaptive(expr); };
+    const auto derivativeFunc = [&var](const Expression &expr) { (void)derivative(expr, var); };
+    const auto solveFunc = [](const Expression &expr) { (void)solve(expr); };
+
+    const std::vector<std::vector<MathObjectClass>> simplifyClasses = isSelected("is") || isSelected("isChainWalk")
+                                                                          ? collectClasses(simplifyExprs)
+                                                                          : std::vector<std::vector<MathObjectClass>>{};
+    const std::vector<MathObjectClass> isTargets = {
+        IMathObject::getClassStatic(),
+        IArithmetic::getClassStatic(),
+        IComparable::getClassStatic(),
+        INumber::getClassStatic(),
+        ILiteral::getClassStatic(),
+        IConstant::getClassStatic(),
+        IFunction::getClassStatic(),
+        IOperator::getClassStatic(),
+        IExpression::getClassStatic(),
+        Integer::getClassStatic(),
+        Rational::getClassStatic(),
+        Variable::getClassStatic(),
+    };
+
+    const auto makeIsFunc = [&isTargets](auto isFunc) {
+      return [&isTargets, isFunc](const std::vector<MathObjectClass> &classes) {
+        size_t count = 0;
+
+        for (const MathObjectClass to : isTargets) {
+          for (const MathObjectClass from : classes) {
+            count += isFunc(to, from) ? 1 : 0;
+          }
+        }
+
+        volatile size_t sink = count;
+        (void)sink;
+      };
+    };
+
+    std::vector<PhaseResult> results;
+
+    if (isSelected("parse")) {
+      results.emplace_back(runPhase<std::string>("parse", allStrs, parseFunc, options.repetitions));
+    }
+
+    if (isSelected("toString")) {
+      results.emplace_back(runPhase<Expression>("toString", allExprs, toStringFunc, options.repetitions));
+    }
+
+    if (isSelected("approximate")) {
+      results.emplace_back(runPhase<Expression>("approximate", approximateExprs, approximateFunc, options.repetitions));
+    }
+
+    if (isSelected("approximateAdaptive")) {
+      results.emplace_back(runPhase<Expression>("approximateAdaptive", approximateExprs, approximateAdaptiveFunc, options.repetitions));
+    }
+
+    if (isSelected("derivative")) {
+      results.emplace_back(runPhase<Expression>("derivative", simplifyExprs, derivativeFunc, options.repetitions));
+    }
+
+    if (isSelected("solve")) {
+      results.emplace_back(runPhase<Expression>("solve", solveExprs, solveFunc, options.repetitions));
+    }
+
+    if (isSelected("is")) {
+      const auto isFunc = makeIsFunc([](MathObjectClass to, MathObjectClass from) { return is(to, from); });
+      results.emplace_back(runPhase<std::vector<MathObjectClass>>("is", simplifyClasses, isFunc, options.repetitions));
+    }
+
+    if (isSelected("isChainWalk")) {
+      const auto isFunc = makeIsFunc(isChainWalk);
+      results.emplace_back(runPhase<std::vector<MathObjectClass>>("isChainWalk", simplifyClasses, isFunc, options.repetitions));
+    }
+
+    if (options.jsonPath == "-") {
+      std::cout << toJson(results);
+      return 0;
+    }
+
+    std::cout << toText(results);
+
+    if (!options.jsonPath.empty()) {
+      std::ofstream(options.jsonPath) << toJson(results);
+    }
+  }
+  catch (const std::exception &exc) {
+    std::cerr << exc.what() << '\n'
+              << usage;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include "Corpus.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <fmt/core.h>
+
+namespace fintamath::benchmarks {
+
+namespace {
+
+std::string unescapeLiteral(const std::string &literal) {
+  std::string res;
+  res.reserve(literal.size());
+
+  for (size_t i = 0; i < literal.size(); i++) {
+    if (literal[i] == '\\' && i + 1 < literal.size()) {
+      i++;
+    }
+
+    res += literal[i];
+  }
+
+  return res;
+}
+
+void loadSuite(const std::filesystem::path &dir, std::vector<std::string> &suite) {
+  static const std::regex expressionRegex(R"re(Expression\("((?:[^"\\]|\\.)*)"\))re");
+
+  if (!std::filesystem::is_directory(dir)) {
+    throw std::runtime_error(fmt::format(R"(Corpus directory "{}" does not exist)", dir.string()));
+  }
+
+  std::vector<std::filesystem::path> files;
+
+  for (const auto &entry : std::filesystem::directory_iterator(dir)) {
+    if (entry.is_regular_file() && entry.path().extension() == ".cpp") {
+      files.emplace_back(entry.path());
+    }
+  }
+
+  std::sort(files.begin(), files.end());
+
+  std::unordered_set<std::string> loaded(suite.begin(), suite.end());
+
+  for (const auto &file : files) {
+    std::ifstream stream(file);
+    std::stringstream content;
+    content << stream.rdbuf();
+    const std::string str = content.str();
+
+    for (auto iter = std::sregex_iterator(str.begin(), str.end(), expressionRegex); iter != std::sregex_iterator(); ++iter) {
+      std::string expr = unescapeLiteral((*iter)[1].str());
+
+      if (loaded.insert(expr).second) {
+        suite.emplace_back(std::move(expr));
+      }
+    }
+  }
+}
+
+}
+
+Corpus loadCorpus(const std::filesystem::path &dir) {
+  Corpus corpus;
+  loadSuite(dir / "simplify", corpus.simplify);
+  loadSuite(dir / "approximate", corpus.approximate);
+  loadSuite(dir / "solve", corpus.solve);
+  return corpus;
+}
+
+}
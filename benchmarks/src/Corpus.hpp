@@ -0,0 +1,20 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace fintamath::benchmarks {
+
+struct Corpus {
+  std::vector<std::string> simplify;
+
+  std::vector<std::string> approximate;
+
+  std::vector<std::string> solve;
+};
+
+// Collect string literals passed to Expression("...") in the test suites from tests/src/overall.
+Corpus loadCorpus(const std::filesystem::path &dir);
+
+}
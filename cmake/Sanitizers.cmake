@@ -6,4 +6,12 @@ if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU" OR CMAKE_CXX_COMPILER_ID MATCHES ".*Clan
     set(sanitizers "address,undefined")
     set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -fsanitize=${sanitizers}")
   endif()
+
+  option(${PROJECT_NAME}_enable_thread_sanitizer "Enable thread sanitizer" OFF)
+  if(${PROJECT_NAME}_enable_thread_sanitizer)
+    if(${PROJECT_NAME}_enable_sanitizers)
+      message(FATAL_ERROR "Thread sanitizer cannot be combined with address sanitizer")
+    endif()
+    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -fsanitize=thread")
+  endif()
 endif()
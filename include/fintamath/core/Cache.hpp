@@ -1,7 +1,12 @@
 #pragma once
 
 #include <functional>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
+#include <utility>
+
+#include "fintamath/core/Hash.hpp"
 
 namespace fintamath::detail {
 
@@ -13,18 +18,29 @@ public:
 public:
   explicit Cache(const Function &inKeyToValueFunction) : keyToValueFunction(inKeyToValueFunction) {}
 
+  // Values are never removed, so returned references stay valid after the lock is released
   const Value &operator[](const Key &key) {
-    if (!keyToValueMap.contains(key)) {
-      keyToValueMap[key] = keyToValueFunction(key);
+    {
+      std::shared_lock lock(mutex);
+
+      if (auto iter = keyToValueMap.find(key); iter != keyToValueMap.end()) {
+        return iter->second;
+      }
     }
 
-    return keyToValueMap.at(key);
+    // Computed without the lock, so the function may use other caches and the same key may be computed twice
+    Value value = keyToValueFunction(key);
+
+    std::scoped_lock lock(mutex);
+    return keyToValueMap.try_emplace(key, std::move(value)).first->second;
   }
 
 private:
-  std::unordered_map<Key, Value> keyToValueMap;
+  std::unordered_map<Key, Value, Hash<Key>> keyToValueMap;
 
   Function keyToValueFunction;
+
+  std::shared_mutex mutex;
 };
 
 }
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <functional>
+#include <optional>
 #include <tuple>
 
 #include "fintamath/core/CoreUtils.hpp"
@@ -42,4 +45,49 @@ private:
   }
 };
 
+// Lazily computed hash of an immutable object.
+// Copies start empty as they may be modified before the hash is requested.
+class CachedHash final {
+public:
+  CachedHash() noexcept = default;
+
+  CachedHash(const CachedHash & /*rhs*/) noexcept {
+  }
+
+  CachedHash &operator=(const CachedHash & /*rhs*/) noexcept {
+    reset();
+    return *this;
+  }
+
+  ~CachedHash() noexcept = default;
+
+  std::optional<size_t> get() const noexcept {
+    const size_t hash = value.load(std::memory_order_relaxed);
+
+    if (hash == emptyValue) {
+      return {};
+    }
+
+    return hash;
+  }
+
+  size_t set(size_t hash) noexcept {
+    if (hash == emptyValue) {
+      hash++;
+    }
+
+    value.store(hash, std::memory_order_relaxed);
+    return hash;
+  }
+
+  void reset() noexcept {
+    value.store(emptyValue, std::memory_order_relaxed);
+  }
+
+private:
+  static constexpr size_t emptyValue = 0;
+
+  std::atomic<size_t> value = emptyValue;
+};
+
 }
@@ -11,6 +11,8 @@
 
 namespace fintamath {
 
+class MathObjectIdStorage;
+
 namespace detail {
 
 class MathObjectClassImpl final {
@@ -41,11 +43,35 @@ public:
     return parent;
   }
 
+  // 0 if the class is not registered
+  size_t getId() const noexcept {
+    return id;
+  }
+
+  // Registered classes and their parents are numbered in pre-order,
+  // so the subclasses of a class form the interval [subtreeBegin, subtreeEnd).
+  // Both are 0 if the class is not numbered.
+  size_t getSubtreeBegin() const noexcept {
+    return subtreeBegin;
+  }
+
+  size_t getSubtreeEnd() const noexcept {
+    return subtreeEnd;
+  }
+
 private:
   Name name;
 
   Ptr parent;
 
+  mutable size_t id = 0;
+
+  mutable size_t subtreeBegin = 0;
+
+  mutable size_t subtreeEnd = 0;
+
+  friend class fintamath::MathObjectIdStorage;
+
   [[maybe_unused]] inline static const Config config;
 };
 
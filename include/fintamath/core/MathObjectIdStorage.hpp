@@ -1,24 +1,30 @@
 #pragma once
 
-#include <unordered_map>
+#include <cstddef>
+#include <vector>
 
 #include "fintamath/core/MathObjectClass.hpp"
 
 namespace fintamath {
 
 class MathObjectIdStorage {
-  using MathObjectClassToIdMap = std::unordered_map<MathObjectClass, size_t>;
-
 public:
   static size_t get(MathObjectClass objClass);
 
   static void add(MathObjectClass objClass);
 
+  // Numbers subtrees of the registered classes once the built-in classes are registered.
+  // The numbering is never changed after that, because other threads may read it,
+  // classes registered later stay not numbered and their parents are walked instead.
+  static void numberSubtrees();
+
 private:
-  static MathObjectClassToIdMap &getMap();
+  static std::vector<MathObjectClass> &getClasses();
 
 private:
   static inline size_t maxId = 1;
+
+  static inline bool areSubtreesNumbered = false;
 };
 
 }
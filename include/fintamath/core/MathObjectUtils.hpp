@@ -13,6 +13,10 @@ namespace fintamath {
 class IMathObject;
 
 constexpr bool is(const MathObjectClass to, const MathObjectClass from) noexcept {
+  if (to && from && to->getSubtreeBegin() != 0 && from->getSubtreeBegin() != 0) {
+    return to->getSubtreeBegin() <= from->getSubtreeBegin() && from->getSubtreeBegin() < to->getSubtreeEnd();
+  }
+
   for (MathObjectClass parent = from; parent; parent = parent->getParent()) {
     if (parent == to) {
       return true;
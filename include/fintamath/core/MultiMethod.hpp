@@ -1,8 +1,15 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "fintamath/core/Hash.hpp"
 #include "fintamath/core/MathObjectClass.hpp"
@@ -22,22 +29,57 @@ class MultiMethod<Res(ArgsBase...)> final {
 
   using Callback = std::function<Res(ArgsBase...)>;
 
-  using IdToCallbackMap = std::unordered_map<CallbackId, Callback, Hash<CallbackId>>;
+  using IdToCallbackIndexMap = std::unordered_map<CallbackId, size_t, Hash<CallbackId>>;
+
+  // Maps ids of the classes met in one argument position to dense indices
+  struct ArgIndex {
+    std::vector<size_t> idToIndex;
+
+    std::vector<MathObjectClass> indexToClass;
+  };
+
+  static constexpr size_t argsSize = sizeof...(ArgsBase);
+
+  static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+  static constexpr size_t maxTableSize = 1U << 16U;
+
+  // Built on the first call after registration, so adding callbacks one by one does not rebuild it every time
+  struct Table {
+    std::once_flag isBuilt;
+
+    std::array<ArgIndex, argsSize> argIndexes;
+
+    // Dense row-major table of callback indices over the argument indices
+    std::vector<size_t> callbackIndices;
+  };
 
 public:
   template <typename... Args>
     requires(sizeof...(Args) == sizeof...(ArgsBase))
   void add(const auto &func) {
-    idToCallbackMap[CallbackId(Args::getClassStatic()...)] = [func](const ArgsBase &...args) {
+    Callback callback = [func](const ArgsBase &...args) {
       return func(cast<Args>(args)...);
     };
+
+    const CallbackId callbackId(Args::getClassStatic()...);
+
+    if (auto iter = idToCallbackIndexMap.find(callbackId); iter != idToCallbackIndexMap.end()) {
+      callbacks[iter->second] = std::move(callback);
+    }
+    else {
+      idToCallbackIndexMap.emplace(callbackId, callbacks.size());
+      callbacks.emplace_back(std::move(callback));
+    }
+
+    table = std::make_shared<Table>();
   }
 
   template <typename... Args>
     requires(sizeof...(Args) == sizeof...(ArgsBase))
   Res operator()(Args &&...args) const {
-    if (auto iter = idToCallbackMap.find(CallbackId(args.getClass()...)); iter != idToCallbackMap.end()) {
-      return iter->second(std::forward<Args>(args)...);
+    if (const size_t callbackIndex = findCallbackIndex(args.getClass()...); callbackIndex != npos) {
+      return callbacks[callbackIndex](std::forward<Args>(args)...);
     }
 
     return {};
@@ -46,11 +88,109 @@ public:
   template <typename... Args>
     requires(sizeof...(Args) == sizeof...(ArgsBase))
   bool contains(const Args &...args) const {
-    return idToCallbackMap.contains(CallbackId(args.getClass()...));
+    return findCallbackIndex(args.getClass()...) != npos;
+  }
+
+private:
+  size_t findCallbackIndex(const ArgId<ArgsBase>... argClasses) const {
+    std::call_once(table->isBuilt, [this] { buildTable(*table); });
+
+    if (!table->callbackIndices.empty()) {
+      size_t tableIndex = 0;
+      size_t argNum = 0;
+
+      if ((findTableIndex(table->argIndexes, argClasses, argNum++, tableIndex) && ...)) {
+        return table->callbackIndices[tableIndex];
+      }
+    }
+
+    // Classes registered after the table was built are looked up by hash
+    if (auto iter = idToCallbackIndexMap.find(CallbackId(argClasses...)); iter != idToCallbackIndexMap.end()) {
+      return iter->second;
+    }
+
+    return npos;
+  }
+
+  static bool findTableIndex(const std::array<ArgIndex, argsSize> &argIndexes, const MathObjectClass argClass, const size_t argNum, size_t &tableIndex) {
+    const ArgIndex &argIndex = argIndexes[argNum];
+    const size_t id = argClass->getId();
+
+    if (id >= argIndex.idToIndex.size()) {
+      return false;
+    }
+
+    const size_t index = argIndex.idToIndex[id];
+
+    // The id is reassigned when the class is registered again
+    if (index == npos || argIndex.indexToClass[index] != argClass) {
+      return false;
+    }
+
+    tableIndex = tableIndex * argIndex.indexToClass.size() + index;
+    return true;
+  }
+
+  void buildTable(Table &res) const {
+    for (const auto &[callbackId, callbackIndex] : idToCallbackIndexMap) {
+      addToArgIndexes(res.argIndexes, callbackId, std::make_index_sequence<argsSize>{});
+    }
+
+    size_t tableSize = 1;
+
+    for (const ArgIndex &argIndex : res.argIndexes) {
+      tableSize *= argIndex.indexToClass.size();
+
+      if (tableSize == 0 || tableSize > maxTableSize) {
+        return;
+      }
+    }
+
+    res.callbackIndices.assign(tableSize, npos);
+
+    for (const auto &[callbackId, callbackIndex] : idToCallbackIndexMap) {
+      if (size_t tableIndex = 0; findTableIndex(res.argIndexes, callbackId, tableIndex, std::make_index_sequence<argsSize>{})) {
+        res.callbackIndices[tableIndex] = callbackIndex;
+      }
+    }
+  }
+
+  template <size_t... argNums>
+  static bool findTableIndex(const std::array<ArgIndex, argsSize> &argIndexes, const CallbackId &callbackId, size_t &tableIndex, std::index_sequence<argNums...> /*unused*/) {
+    return (findTableIndex(argIndexes, std::get<argNums>(callbackId), argNums, tableIndex) && ...);
+  }
+
+  template <size_t... argNums>
+  static void addToArgIndexes(std::array<ArgIndex, argsSize> &argIndexes, const CallbackId &callbackId, std::index_sequence<argNums...> /*unused*/) {
+    (addToArgIndex(argIndexes, std::get<argNums>(callbackId), argNums), ...);
+  }
+
+  static void addToArgIndex(std::array<ArgIndex, argsSize> &argIndexes, const MathObjectClass argClass, const size_t argNum) {
+    ArgIndex &argIndex = argIndexes[argNum];
+    const size_t id = argClass->getId();
+
+    // Unregistered classes are looked up by hash
+    if (id == 0) {
+      return;
+    }
+
+    if (id >= argIndex.idToIndex.size()) {
+      argIndex.idToIndex.resize(id + 1, npos);
+    }
+
+    if (argIndex.idToIndex[id] == npos) {
+      argIndex.idToIndex[id] = argIndex.indexToClass.size();
+      argIndex.indexToClass.emplace_back(argClass);
+    }
   }
 
 private:
-  IdToCallbackMap idToCallbackMap;
+  IdToCallbackIndexMap idToCallbackIndexMap;
+
+  std::vector<Callback> callbacks;
+
+  // Copies share the table until one of them is changed
+  std::shared_ptr<Table> table = std::make_shared<Table>();
 };
 
 }
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+
+namespace fintamath::detail {
+
+// Thread-local free lists of small blocks for short-lived tree nodes.
+// Freed blocks are reused by the thread which frees them,
+// its excess blocks and the blocks left on its exit are handed over to other threads.
+class NodePool final {
+public:
+  static constexpr size_t maxBlockSize = 256;
+
+public:
+  static void *allocate(size_t size);
+
+  static void deallocate(void *ptr, size_t size) noexcept;
+};
+
+}
@@ -58,6 +58,11 @@ public:
   }
 
   std::optional<Return> parseFirst(std::string str) const {
+    // Names are resolved without starting a coroutine
+    if (const auto stringToConstructors = stringToConstructorsMap.find(str); stringToConstructors != stringToConstructorsMap.end()) {
+      return stringToConstructors->second.front()();
+    }
+
     auto gener = parse(std::move(str));
 
     if (auto iter = gener.begin(); iter != gener.end()) {
@@ -67,6 +72,7 @@ public:
     return {};
   }
 
+  // Registration is not synchronized with parsing, types must be registered before other threads start
   template <typename Type>
     requires(!std::is_abstract_v<Type> && !StringConstructable<Type> && EmptyConstructable<Type>)
   void registerType() {
@@ -90,6 +96,8 @@ public:
         // Go to the next constructor
       }
     });
+
+    Tokenizer::updateRegistrationVersion();
   }
 
   template <typename Type>
@@ -100,6 +108,8 @@ public:
         co_yield std::move(value);
       }
     });
+
+    Tokenizer::updateRegistrationVersion();
   }
 
   template <typename Type>
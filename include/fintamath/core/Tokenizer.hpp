@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace fintamath::detail {
@@ -9,21 +12,33 @@ using Token = std::string;
 using TokenVector = std::vector<Token>;
 
 class Tokenizer final {
+  struct TrieNode {
+    std::unordered_map<char, size_t> childToIndexMap;
+
+    bool isToken = false;
+  };
+
+  using Trie = std::vector<TrieNode>;
+
 public:
-  static TokenVector tokenize(std::string str);
+  static TokenVector tokenize(std::string_view str);
 
+  // Not synchronized with tokenize, tokens must be registered before other threads start
   static void registerToken(const Token &token);
 
-private:
-  static bool appendToken(TokenVector &tokens, Token &token, bool shouldSplit = false);
+  // Changed by every registration of a token or a parsed type, so caches of parsing results can be keyed by it
+  static size_t getRegistrationVersion();
+
+  static void updateRegistrationVersion();
 
-  static void handleSpaces(std::string &str);
+private:
+  static size_t findRegisteredTokenSize(std::string_view str);
 
   static bool isDigitOrPoint(char ch);
 
   static bool isSpace(char ch);
 
-  static TokenVector &getRegisteredTokens();
+  static Trie &getRegisteredTokens();
 };
 
 }
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "fintamath/core/Cache.hpp"
+#include "fintamath/expressions/Expression.hpp"
+#include "fintamath/functions/FunctionArguments.hpp"
+#include "fintamath/literals/Variable.hpp"
+#include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+
+namespace fintamath {
+
+// Postfix program over the variables of a simplified expression. Evaluation does not build expression nodes.
+class CompiledExpression final {
+public:
+  enum class Operation : uint8_t {
+    Constant,
+    Variable,
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Neg,
+    Abs,
+    Pow,
+    Sqrt,
+    Exp,
+    Log,
+    Ln,
+    Lb,
+    Lg,
+    Sin,
+    Cos,
+    Tan,
+    Cot,
+    Sec,
+    Csc,
+    Asin,
+    Acos,
+    Atan,
+    Acot,
+    Asec,
+    Acsc,
+    Sinh,
+    Cosh,
+    Tanh,
+    Coth,
+    Sech,
+    Csch,
+    Asinh,
+    Acosh,
+    Atanh,
+    Acoth,
+    Asech,
+    Acsch,
+    Floor,
+    Ceil,
+    Factorial,
+  };
+
+  struct Instruction {
+    Operation operation = Operation::Constant;
+
+    // Index of a constant or a variable, number of arguments otherwise
+    size_t argument = 0;
+  };
+
+  struct BatchResult {
+    std::vector<double> values;
+
+    // Nonzero where the value is undefined or out of the double range, the value is NaN there
+    std::vector<uint8_t> undefinedMask;
+  };
+
+  // Up to this precision values are evaluated in doubles with tracked errors, MPFR is used when the digits are not certain
+  static constexpr unsigned maxDoublePrecision = 15;
+
+  // Certified evaluation starts at half of the requested precision and gives up above this multiple of it
+  static constexpr unsigned maxPrecisionGrowth = 8;
+
+public:
+  explicit CompiledExpression(const Expression &expr);
+
+  CompiledExpression(const Expression &expr, std::vector<Variable> inVariables);
+
+  const std::vector<Variable> &getVariables() const noexcept;
+
+  const std::vector<Instruction> &getInstructions() const noexcept;
+
+  const ArgumentPtrVector &getConstants() const noexcept;
+
+  size_t getMaxStackSize() const noexcept;
+
+  // Up to 15 digits evaluates in doubles with tracked errors and falls back to Real if the digits are not certain.
+  // This tier is local to compiled expressions, approximate() of Expression always evaluates with Real.
+  Real evaluate(const std::vector<Real> &values, unsigned precision = Real::getPrecisionStatic()) const;
+
+  // Evaluates with error bounds and doubles the working precision until all the digits are certain.
+  // Returns nothing if this does not happen in time or some function is not defined near the exact value.
+  std::optional<Real> evaluateCertified(const std::vector<Real> &values, unsigned precision = Real::getPrecisionStatic()) const;
+
+  // One column of values per variable, all columns must have the same size. Without variables one point is evaluated.
+  BatchResult evaluateBatch(const std::vector<std::vector<double>> &columns) const;
+
+private:
+  void validateValues(const std::vector<Real> &values) const;
+
+  unsigned getOutputPrecision(const std::vector<Real> &values) const;
+
+  std::optional<Real> evaluateDouble(const std::vector<Real> &values, unsigned precision) const;
+
+  std::optional<RealBall> evaluateBall(const std::vector<Real> &values) const;
+
+  void compile(const ArgumentPtr &arg, size_t &stackSize);
+
+  void addInstruction(Operation operation, size_t argument, size_t &stackSize);
+
+private:
+  std::vector<Variable> variables;
+
+  std::vector<Instruction> instructions;
+
+  ArgumentPtrVector constants;
+
+  std::vector<double> constantDoubleValues;
+
+  std::vector<double> constantDoubleErrors;
+
+  size_t maxStackSize = 0;
+
+  std::string exprString;
+
+  // Shared between copies, constants do not change after compilation
+  std::shared_ptr<detail::Cache<unsigned, std::vector<Real>>> precisionToConstantValuesCache;
+};
+
+}
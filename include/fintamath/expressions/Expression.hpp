@@ -1,9 +1,11 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <stack>
 #include <string>
@@ -78,6 +80,16 @@ public:
 
   Expression(int64_t val);
 
+  Expression(const Expression &rhs);
+
+  Expression(Expression &&rhs) noexcept;
+
+  Expression &operator=(const Expression &rhs);
+
+  Expression &operator=(Expression &&rhs) noexcept;
+
+  ~Expression() override = default;
+
   std::string toString() const override;
 
   const std::shared_ptr<IFunction> &getFunction() const override;
@@ -90,7 +102,10 @@ public:
 
   void setVariable(const Variable &var, const Expression &val);
 
+  bool isInternable() const override;
+
   template <typename Function>
+  // Not synchronized with parsing, constructors must be registered before other threads start
   static void registerExpressionConstructor(ExpressionConstructor constructor);
 
 protected:
@@ -99,7 +114,7 @@ protected:
 private:
   void simplifyMutable() const;
 
-  void updateStringMutable() const;
+  void updateCachedMutable() const;
 
   static detail::TermVector tokensToTerms(detail::TokenVector &tokens);
 
@@ -113,6 +128,10 @@ private:
 
   static detail::Term parseTerm(const std::string &str);
 
+  static std::unique_ptr<IMathObject> parseNumberTerm(const std::string &str);
+
+  static bool isNameTerm(const std::string &str);
+
   static void moveFunctionTermsToObjects(detail::ObjectStack &objects, detail::FunctionTermStack &functions, const IOperator *nextOper);
 
   static void insertMultiplications(detail::TermVector &terms);
@@ -158,7 +177,10 @@ private:
 
   mutable std::string stringCached;
 
-  mutable bool isSimplified = false;
+  // Simplification is lazy and done once under the mutex, so one const expression can be read from many threads
+  mutable std::atomic<bool> isSimplified = false;
+
+  mutable std::mutex mutex;
 };
 
 std::unique_ptr<IMathObject> parseRawExpr(const std::string &str);
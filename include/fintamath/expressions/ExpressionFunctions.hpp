@@ -107,4 +107,8 @@ Expression solve(const Expression &rhs);
 
 extern Expression approximate(const Expression &rhs, unsigned precision = Real::getPrecisionStatic());
 
+// Like approximate, but subexpressions without variables are evaluated with error bounds,
+// starting from a low precision and raising it only where digits are lost
+Expression approximateAdaptive(const Expression &rhs, unsigned precision = Real::getPrecisionStatic());
+
 }
@@ -46,6 +46,9 @@ ArgumentPtr simplifyUndefined(const IFunction &func, const std::same_as<Argument
   return res;
 }
 
+// Unlike operator==, does not treat numbers of different types or precisions as identical.
+bool isIdentical(const IMathObject &lhs, const IMathObject &rhs);
+
 bool isInfinity(const ArgumentPtr &arg);
 
 bool isMulInfinity(const ArgumentPtr &arg);
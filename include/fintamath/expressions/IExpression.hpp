@@ -1,16 +1,19 @@
 #pragma once
 
 #include <concepts>
+#include <cstddef>
 #include <memory>
 #include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "fintamath/core/Hash.hpp"
 #include "fintamath/core/IMathObject.hpp"
 #include "fintamath/core/MathObjectClass.hpp"
 #include "fintamath/core/MathObjectUtils.hpp"
 #include "fintamath/core/Parser.hpp"
+#include "fintamath/expressions/SimplifyCache.hpp"
 #include "fintamath/functions/FunctionArguments.hpp"
 #include "fintamath/functions/IFunction.hpp"
 #include "fintamath/literals/Variable.hpp"
@@ -40,6 +43,16 @@ public:
 
   virtual const std::shared_ptr<IFunction> &getOutputFunction() const;
 
+  // Structural hash consistent with operator==, computed once per object.
+  size_t getHash() const;
+
+  // Return false if the object has state that is not compared by operator==.
+  virtual bool isInternable() const;
+
+  static void *operator new(size_t size);
+
+  static void operator delete(void *ptr, size_t size) noexcept;
+
 protected:
   virtual ArgumentPtr simplify() const;
 
@@ -63,12 +76,22 @@ protected:
 
   static ArgumentPtr callFunction(const IFunction &func, const ArgumentPtrVector &argPtrs);
 
+  // Replace the child with a previously created identical subtree, if it is still alive.
+  static void internChild(ArgumentPtr &child);
+
+  void resetHash() const noexcept;
+
 private:
+  static ArgumentPtr simplifyCached(const std::shared_ptr<const IExpression> &expr, SimplifyCache::Phase phase);
+
   static std::unique_ptr<INumber> convertToApproximated(const INumber &num);
 
   static std::unique_ptr<INumber> convertToApproximated(const INumber &num, unsigned precision, const Integer &maxInt);
 
   static ArgumentPtrVector convertToApproximatedNumbers(const ArgumentPtrVector &args);
+
+private:
+  mutable detail::CachedHash hashCached;
 };
 
 template <typename Derived>
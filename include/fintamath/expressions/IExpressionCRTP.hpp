@@ -11,6 +11,10 @@ class IExpressionCRTP_ : public IExpressionBaseCRTP<Derived> {
 
 public:
   bool equals(const Derived &rhs) const override {
+    if (this->getHash() != rhs.getHash()) {
+      return false;
+    }
+
     if (static_cast<bool>(this->getFunction()) != static_cast<bool>(rhs.getFunction()) ||
         (this->getFunction() && rhs.getFunction() && *this->getFunction() != *rhs.getFunction())) {
 
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "fintamath/functions/FunctionArguments.hpp"
+
+namespace fintamath {
+
+class IExpression;
+
+// Bounded memo of simplified subtrees. Disabled by default, enable it with setCapacity.
+class SimplifyCache final {
+public:
+  enum class Phase : uint8_t {
+    Simplify,
+    PreSimplify,
+    PostSimplify,
+  };
+
+  struct Statistics {
+    size_t hits = 0;
+
+    size_t misses = 0;
+
+    size_t size = 0;
+
+    size_t capacity = 0;
+  };
+
+public:
+  static void setCapacity(size_t capacity);
+
+  static size_t getCapacity() noexcept;
+
+  static void clear();
+
+  static Statistics getStatistics();
+
+private:
+  static ArgumentPtr find(const std::shared_ptr<const IExpression> &expr, Phase phase);
+
+  static void add(const std::shared_ptr<const IExpression> &expr, Phase phase, const ArgumentPtr &res);
+
+  friend class IExpression;
+};
+
+}
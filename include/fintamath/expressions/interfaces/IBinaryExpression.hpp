@@ -51,7 +51,8 @@ protected:
   ArgumentPtr rhsChild;
 
 private:
-  mutable ArgumentPtrVector childrenCached = {{}, {}};
+  // Updated together with the children, so that getChildren does not write to a possibly shared object
+  ArgumentPtrVector childrenCached = {{}, {}};
 };
 
 template <typename Derived>
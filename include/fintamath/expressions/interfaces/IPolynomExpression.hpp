@@ -50,6 +50,9 @@ protected:
 
   virtual std::strong_ordering compare(const ArgumentPtr &lhs, const ArgumentPtr &rhs) const;
 
+  // Combines numeric children at once before the pairwise simplification
+  virtual void simplifyNumbers();
+
 private:
   void simplifyRec(bool isPostSimplify);
 
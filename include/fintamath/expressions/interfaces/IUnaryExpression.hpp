@@ -49,7 +49,7 @@ private:
   ArgumentPtr simplifyRec(bool isPostSimplify) const;
 
 private:
-  mutable ArgumentPtrVector childrenCached = {{}};
+  ArgumentPtrVector childrenCached = {{}};
 };
 
 template <typename Derived>
@@ -2,6 +2,7 @@
 
 #include <concepts>
 #include <memory>
+#include <optional>
 
 #include "fintamath/core/IMathObject.hpp"
 #include "fintamath/functions/FunctionArguments.hpp"
@@ -44,6 +45,16 @@ std::unique_ptr<IMathObject> makeExprWithValidation(const IFunction &func, std::
 
 ArgumentPtrVector argumentRefVectorToArgumentPtrVector(const ArgumentRefVector &args);
 
+// Null result means that the function is not evaluated
+template <std::derived_from<IMathObject> T>
+std::unique_ptr<IMathObject> cloneIfDefined(const std::optional<T> &obj) {
+  if (!obj) {
+    return {};
+  }
+
+  return obj->clone();
+}
+
 }
 
 }
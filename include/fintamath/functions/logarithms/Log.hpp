@@ -12,6 +12,7 @@
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
 
 namespace fintamath {
 
@@ -33,6 +34,8 @@ protected:
   static std::unique_ptr<IMathObject> logSimplify(const Rational &lhs, const Rational &rhs);
 
   static std::unique_ptr<IMathObject> logSimplify(const Real &lhs, const Real &rhs);
+
+  static std::unique_ptr<IMathObject> logSimplify(const RealBall &lhs, const RealBall &rhs);
 };
 
 FINTAMATH_FUNCTION_EXPRESSION(Log, logExpr);
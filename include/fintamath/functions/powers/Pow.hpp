@@ -15,6 +15,7 @@ namespace fintamath {
 class Integer;
 class Rational;
 class Real;
+class RealBall;
 class Complex;
 
 class Pow : public IFunctionCRTP<INumber, Pow, INumber, INumber> {
@@ -37,6 +38,10 @@ private:
 
   static std::unique_ptr<IMathObject> powSimplify(const Real &lhs, const Real &rhs);
 
+  static std::unique_ptr<IMathObject> powSimplify(const Real &lhs, const Integer &rhs);
+
+  static std::unique_ptr<IMathObject> powSimplify(const RealBall &lhs, const RealBall &rhs);
+
   static std::unique_ptr<IMathObject> powSimplify(const Complex &lhs, const Complex &rhs);
 };
 
@@ -5,6 +5,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <variant>
 
 #include "fintamath/core/IMathObject.hpp"
 #include "fintamath/core/MathObjectClass.hpp"
@@ -21,25 +22,17 @@ class Complex : public INumberCRTP<Complex> {
 public:
   Complex() = default;
 
-  Complex(const Complex &rhs);
-
-  Complex(Complex &&rhs) noexcept = default;
-
-  Complex &operator=(const Complex &rhs);
-
-  Complex &operator=(Complex &&rhs) noexcept = default;
-
   Complex(const Integer &rhs);
 
   Complex(const Rational &rhs);
 
   Complex(const Real &rhs);
 
-  Complex(std::integral auto rhs) : re(std::make_unique<Integer>(rhs)) {}
+  Complex(std::integral auto rhs) : re(Integer(rhs)) {}
 
   explicit Complex(std::integral auto inReal, std::integral auto inImag)
-      : re(std::make_unique<Integer>(inReal)),
-        im(std::make_unique<Integer>(inImag)) {}
+      : re(Integer(inReal)),
+        im(Integer(inImag)) {}
 
   explicit Complex(const INumber &inReal, const INumber &inImag);
 
@@ -76,9 +69,12 @@ private:
   static std::unique_ptr<INumber> parseNonComplexNumber(const std::string &str);
 
 private:
-  std::unique_ptr<INumber> re = std::make_unique<Integer>(0);
+  // Parts are stored inline in their minimal form, so copies and arithmetic do not allocate per part
+  using Part = std::variant<Integer, Rational, Real>;
+
+  Part re = Integer(0);
 
-  std::unique_ptr<INumber> im = std::make_unique<Integer>(0);
+  Part im = Integer(0);
 };
 
 }
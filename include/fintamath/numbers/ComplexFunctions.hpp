@@ -0,0 +1,10 @@
+#pragma once
+
+#include "fintamath/numbers/Complex.hpp"
+#include "fintamath/numbers/Integer.hpp"
+
+namespace fintamath {
+
+Complex pow(const Complex &lhs, const Integer &rhs);
+
+}
@@ -7,6 +7,8 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <variant>
 
 #include <boost/multiprecision/fwd.hpp>
 #include <boost/multiprecision/gmp.hpp>
@@ -26,7 +28,16 @@ public:
 public:
   Integer() = default;
 
-  Integer(std::integral auto rhs) : backend(rhs) {}
+  Integer(std::integral auto rhs) {
+    if (const auto smallValue = static_cast<int64_t>(rhs);
+        static_cast<decltype(rhs)>(smallValue) == rhs && (std::is_signed_v<decltype(rhs)> || smallValue >= 0)) {
+
+      value = smallValue;
+    }
+    else {
+      value = Backend(rhs);
+    }
+  }
 
   Integer(Backend inBackend);
 
@@ -36,11 +47,25 @@ public:
 
   int sign() const;
 
-  const Backend &getBackend() const noexcept;
+  Backend getBackend() const;
+
+  // Stored GMP value, nullptr for values in the int64_t range.
+  // Lets GMP callers avoid the copy made by getBackend.
+  const Backend *getLargeBackend() const noexcept;
 
   template <std::integral T>
   explicit operator T() const {
-    return backend.convert_to<T>();
+    if (const auto *smallValue = std::get_if<int64_t>(&value)) {
+      if (const auto res = static_cast<T>(*smallValue);
+          static_cast<int64_t>(res) == *smallValue && (std::is_signed_v<T> || *smallValue >= 0)) {
+
+        return res;
+      }
+
+      return Backend(*smallValue).convert_to<T>();
+    }
+
+    return std::get<Backend>(value).convert_to<T>();
   }
 
   Integer &operator%=(const Integer &rhs);
@@ -115,7 +140,17 @@ protected:
   Integer &decrease();
 
 private:
-  Backend backend;
+  Backend &toLarge();
+
+  void normalize();
+
+private:
+  // Values in the int64_t range are always stored inline, GMP is used only for the others
+  std::variant<int64_t, Backend> value;
+
+  friend Integer gcd(const Integer &lhs, const Integer &rhs);
+
+  friend struct std::hash<Integer>;
 };
 
 template <ConvertibleToAndNotSameAs<Integer> Rhs>
@@ -215,6 +250,10 @@ struct std::hash<fintamath::Integer> {
   size_t operator()(const fintamath::Integer &rhs) const noexcept {
     using fintamath::detail::Hash;
 
-    return Hash<fintamath::Integer::Backend>{}(rhs.getBackend());
+    if (const auto *smallValue = std::get_if<int64_t>(&rhs.value)) {
+      return Hash<int64_t>{}(*smallValue);
+    }
+
+    return Hash<fintamath::Integer::Backend>{}(std::get<fintamath::Integer::Backend>(rhs.value));
   }
 };
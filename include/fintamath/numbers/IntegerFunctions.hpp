@@ -11,9 +11,22 @@
 
 namespace fintamath {
 
+class Rational;
+class Real;
+class Complex;
+
 using FactorToCountMap = std::unordered_map<Integer, Integer>;
 
-template <std::derived_from<INumber> Lhs>
+// Integer, Rational, Real and Complex have their own power functions,
+// the generic algorithm must not be chosen for them when those functions are not included
+template <typename Lhs>
+concept GenericPowBase = std::derived_from<Lhs, INumber> &&
+                         !std::same_as<Lhs, Integer> &&
+                         !std::same_as<Lhs, Rational> &&
+                         !std::same_as<Lhs, Real> &&
+                         !std::same_as<Lhs, Complex>;
+
+template <GenericPowBase Lhs>
 Lhs pow(const Lhs &lhs, Integer rhs) {
   if (lhs == 0 && rhs == 0) {
     throw UndefinedException("pow({}, {}) is undefined (zero to the power of zero)");
@@ -43,6 +56,8 @@ Lhs pow(const Lhs &lhs, Integer rhs) {
   return res;
 }
 
+Integer pow(const Integer &lhs, const Integer &rhs);
+
 Integer abs(const Integer &rhs);
 
 Integer gcd(const Integer &lhs, const Integer &rhs);
@@ -53,11 +68,26 @@ Integer sqrt(const Integer &rhs);
 
 Integer sqrt(const Integer &rhs, Integer &remainder);
 
+// Integer part of the root, negative arguments are allowed for odd degrees
+Integer root(const Integer &rhs, const Integer &degree);
+
+Integer root(const Integer &rhs, const Integer &degree, Integer &remainder);
+
+bool isPerfectPower(const Integer &rhs);
+
+// Returns the smallest base with rhs = base^degree, degree is 1 if rhs is not a perfect power
+Integer perfectPowerBase(const Integer &rhs, Integer &degree);
+
 Integer factorial(const Integer &rhs);
 
 Integer factorial(const Integer &rhs, size_t order);
 
-FactorToCountMap factors(Integer rhs, Integer limit = -1);
+// Baillie-PSW and Miller-Rabin tests, no composite numbers passing them are known
+bool isPrime(const Integer &rhs);
+
+// Prime factorization. With a nonnegative limit only the factors up to it are searched
+// and the rest is left as one factor, which may be composite.
+FactorToCountMap factors(const Integer &rhs, const Integer &limit = -1);
 
 Integer combinations(const Integer &totalNumber, const Integer &choosedNumber);
 
@@ -17,6 +17,7 @@ namespace fintamath {
 class Rational : public INumberCRTP<Rational> {
   FINTAMATH_CLASS_BODY(Rational, INumber)
 
+public:
 public:
   Rational() = default;
 
@@ -60,7 +61,32 @@ protected:
 private:
   void toIrreducibleRational();
 
-  static void toCommonDenominators(Rational &lhs, Rational &rhs);
+private:
+  Integer numer = 0;
+
+  Integer denom = 1;
+
+private:
+  friend Rational pow(const Rational &lhs, const Integer &rhs);
+};
+
+namespace detail {
+
+// Sum of rationals which is not reduced until the result is requested,
+// so accumulating many terms needs one gcd instead of one per term
+class RationalAccumulator final {
+public:
+  RationalAccumulator &operator+=(const Rational &rhs);
+
+  // Adds lhs * rhs without reducing the product
+  void addProduct(const Rational &lhs, const Rational &rhs);
+
+  bool isZero() const;
+
+  Rational toRational() const;
+
+private:
+  void add(const Integer &rhsNumer, const Integer &rhsDenom);
 
 private:
   Integer numer = 0;
@@ -70,6 +96,8 @@ private:
 
 }
 
+}
+
 template <>
 struct std::hash<fintamath::Rational> {
   size_t operator()(const fintamath::Rational &rhs) const noexcept {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
 
@@ -11,4 +13,9 @@ Integer ceil(const Rational &rhs);
 
 Rational abs(const Rational &rhs);
 
+Rational pow(const Rational &lhs, const Integer &rhs);
+
+// Exact root if the numerator and the denominator are both perfect powers of the degree
+std::optional<Rational> perfectRoot(const Rational &rhs, const Integer &degree);
+
 }
@@ -74,8 +74,11 @@ public:
 
   static unsigned getPrecisionStatic() noexcept;
 
+  // Precision is thread-local, new threads start with the default one
   static void setPrecisionStatic(unsigned precision);
 
+  static void setDefaultPrecisionStatic(unsigned precision);
+
 protected:
   bool equals(const Real &rhs) const override;
 
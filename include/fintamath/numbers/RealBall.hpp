@@ -0,0 +1,97 @@
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <string>
+
+#include "fintamath/core/Hash.hpp"
+#include "fintamath/core/IArithmetic.hpp"
+#include "fintamath/core/MathObjectClass.hpp"
+#include "fintamath/numbers/INumber.hpp"
+#include "fintamath/numbers/Integer.hpp"
+#include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/Real.hpp"
+
+namespace fintamath {
+
+// Midpoint-radius ball that always contains the exact value.
+// The midpoint is rounded to the nearest, the radius is rounded upwards to cover all rounding errors.
+class RealBall : public INumberCRTP<RealBall> {
+  FINTAMATH_CLASS_BODY(RealBall, INumber)
+
+public:
+  using Backend = Real::Backend;
+
+public:
+  RealBall();
+
+  RealBall(const Integer &rhs);
+
+  RealBall(const Rational &rhs);
+
+  RealBall(const Real &rhs);
+
+  RealBall(std::integral auto rhs) : RealBall(Integer(rhs)) {}
+
+  explicit RealBall(const Real &inMidpoint, const Real &inRadius);
+
+  static RealBall fromBounds(const Backend &lower, const Backend &upper);
+
+  std::string toString() const override;
+
+  // Number of significant digits certified by the radius
+  std::optional<unsigned> getPrecision() const noexcept override;
+
+  // Zero if the ball contains zero
+  int sign() const;
+
+  bool contains(const Real &rhs) const;
+
+  bool containsZero() const;
+
+  const Backend &getMidpoint() const noexcept;
+
+  const Backend &getRadius() const noexcept;
+
+  Backend getLower() const;
+
+  Backend getUpper() const;
+
+protected:
+  bool equals(const RealBall &rhs) const override;
+
+  // Balls are ordered by midpoints and then by radii, overlapping balls are not certainly ordered
+  std::strong_ordering compare(const RealBall &rhs) const override;
+
+  RealBall &add(const RealBall &rhs) override;
+
+  RealBall &substract(const RealBall &rhs) override;
+
+  RealBall &multiply(const RealBall &rhs) override;
+
+  RealBall &divide(const RealBall &rhs) override;
+
+  RealBall &negate() override;
+
+private:
+  Backend midpoint;
+
+  Backend radius;
+};
+
+}
+
+template <>
+struct std::hash<fintamath::RealBall> {
+  size_t operator()(const fintamath::RealBall &rhs) const noexcept {
+    using fintamath::detail::Hash;
+    using fintamath::detail::hashCombine;
+
+    size_t seed = 0;
+    hashCombine(seed, Hash<fintamath::RealBall::Backend>{}(rhs.getMidpoint()));
+    hashCombine(seed, Hash<fintamath::RealBall::Backend>{}(rhs.getRadius()));
+    return seed;
+  }
+};
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <optional>
+
+#include "fintamath/numbers/Integer.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+
+namespace fintamath {
+
+// Results contain the exact values for all points of the arguments,
+// UndefinedException is thrown if a function is not defined for the whole ball
+
+Integer floor(const RealBall &rhs);
+
+Integer ceil(const RealBall &rhs);
+
+RealBall abs(const RealBall &rhs);
+
+RealBall sqrt(const RealBall &rhs);
+
+RealBall pow(const RealBall &lhs, const RealBall &rhs);
+
+RealBall exp(const RealBall &rhs);
+
+RealBall log(const RealBall &lhs, const RealBall &rhs);
+
+RealBall ln(const RealBall &rhs);
+
+RealBall lb(const RealBall &rhs);
+
+RealBall lg(const RealBall &rhs);
+
+RealBall sin(const RealBall &rhs);
+
+RealBall cos(const RealBall &rhs);
+
+RealBall tan(const RealBall &rhs);
+
+RealBall cot(const RealBall &rhs);
+
+RealBall sec(const RealBall &rhs);
+
+RealBall csc(const RealBall &rhs);
+
+RealBall asin(const RealBall &rhs);
+
+RealBall acos(const RealBall &rhs);
+
+RealBall atan(const RealBall &rhs);
+
+RealBall acot(const RealBall &rhs);
+
+RealBall asec(const RealBall &rhs);
+
+RealBall acsc(const RealBall &rhs);
+
+RealBall sinh(const RealBall &rhs);
+
+RealBall cosh(const RealBall &rhs);
+
+RealBall tanh(const RealBall &rhs);
+
+RealBall coth(const RealBall &rhs);
+
+RealBall sech(const RealBall &rhs);
+
+RealBall csch(const RealBall &rhs);
+
+RealBall asinh(const RealBall &rhs);
+
+RealBall acosh(const RealBall &rhs);
+
+RealBall atanh(const RealBall &rhs);
+
+RealBall acoth(const RealBall &rhs);
+
+RealBall asech(const RealBall &rhs);
+
+RealBall acsch(const RealBall &rhs);
+
+namespace detail {
+
+// Used during evaluation of expressions, return nothing instead of throwing UndefinedException
+
+std::optional<Integer> tryFloor(const RealBall &rhs);
+
+std::optional<Integer> tryCeil(const RealBall &rhs);
+
+std::optional<RealBall> trySqrt(const RealBall &rhs);
+
+std::optional<RealBall> tryPow(const RealBall &lhs, const RealBall &rhs);
+
+std::optional<RealBall> tryExp(const RealBall &rhs);
+
+std::optional<RealBall> tryLog(const RealBall &lhs, const RealBall &rhs);
+
+std::optional<RealBall> tryLn(const RealBall &rhs);
+
+std::optional<RealBall> tryLb(const RealBall &rhs);
+
+std::optional<RealBall> tryLg(const RealBall &rhs);
+
+std::optional<RealBall> trySin(const RealBall &rhs);
+
+std::optional<RealBall> tryCos(const RealBall &rhs);
+
+std::optional<RealBall> tryTan(const RealBall &rhs);
+
+std::optional<RealBall> tryCot(const RealBall &rhs);
+
+std::optional<RealBall> trySec(const RealBall &rhs);
+
+std::optional<RealBall> tryCsc(const RealBall &rhs);
+
+std::optional<RealBall> tryAsin(const RealBall &rhs);
+
+std::optional<RealBall> tryAcos(const RealBall &rhs);
+
+std::optional<RealBall> tryAtan(const RealBall &rhs);
+
+std::optional<RealBall> tryAcot(const RealBall &rhs);
+
+std::optional<RealBall> tryAsec(const RealBall &rhs);
+
+std::optional<RealBall> tryAcsc(const RealBall &rhs);
+
+std::optional<RealBall> trySinh(const RealBall &rhs);
+
+std::optional<RealBall> tryCosh(const RealBall &rhs);
+
+std::optional<RealBall> tryTanh(const RealBall &rhs);
+
+std::optional<RealBall> tryCoth(const RealBall &rhs);
+
+std::optional<RealBall> trySech(const RealBall &rhs);
+
+std::optional<RealBall> tryCsch(const RealBall &rhs);
+
+std::optional<RealBall> tryAsinh(const RealBall &rhs);
+
+std::optional<RealBall> tryAcosh(const RealBall &rhs);
+
+std::optional<RealBall> tryAtanh(const RealBall &rhs);
+
+std::optional<RealBall> tryAcoth(const RealBall &rhs);
+
+std::optional<RealBall> tryAsech(const RealBall &rhs);
+
+std::optional<RealBall> tryAcsch(const RealBall &rhs);
+
+}
+
+}
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <optional>
+#include <string>
+
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Real.hpp"
 
@@ -15,6 +18,8 @@ Real sqrt(const Real &rhs);
 
 Real pow(const Real &lhs, const Real &rhs);
 
+Real pow(const Real &lhs, const Integer &rhs);
+
 Real exp(const Real &rhs);
 
 Real log(const Real &lhs, const Real &rhs);
@@ -79,4 +84,84 @@ const Real &getE();
 
 const Real &getPi();
 
+// Euler-Mascheroni constant
+const Real &getEulerGamma();
+
+namespace detail {
+
+// Used during evaluation of expressions, return nothing instead of throwing UndefinedException.
+// The cause of an empty result is written to reason if it is given.
+
+std::optional<Integer> tryFloor(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Integer> tryCeil(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> trySqrt(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryPow(const Real &lhs, const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryPow(const Real &lhs, const Integer &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryExp(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryLog(const Real &lhs, const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryLn(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryLb(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryLg(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> trySin(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryCos(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryTan(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryCot(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> trySec(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryCsc(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryAsin(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryAcos(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryAtan(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryAcot(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryAsec(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryAcsc(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> trySinh(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryCosh(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryTanh(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryCoth(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> trySech(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryCsch(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryAsinh(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryAcosh(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryAtanh(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryAcoth(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryAsech(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryAcsch(const Real &rhs, std::string *reason = nullptr);
+
+std::optional<Real> tryTgamma(const Real &rhs, std::string *reason = nullptr);
+
+}
+
 }
@@ -7,6 +7,7 @@
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
 
 namespace fintamath::detail {
 
@@ -32,6 +33,19 @@ ConverterConfig::ConverterConfig() {
     return Real(value).clone();
   });
 
+  Converter::add<RealBall, RealBall>([](const RealBall & /*type*/, const RealBall &value) {
+    return RealBall(value).clone();
+  });
+  Converter::add<RealBall, Integer>([](const RealBall & /*type*/, const Integer &value) {
+    return RealBall(value).clone();
+  });
+  Converter::add<RealBall, Rational>([](const RealBall & /*type*/, const Rational &value) {
+    return RealBall(value).clone();
+  });
+  Converter::add<RealBall, Real>([](const RealBall & /*type*/, const Real &value) {
+    return RealBall(value).clone();
+  });
+
   Converter::add<Complex, Complex>([](const Complex & /*type*/, const Complex &value) {
     return std::make_unique<Complex>(value);
   });
@@ -3,6 +3,7 @@
 #include "fintamath/core/IArithmetic.hpp"
 #include "fintamath/core/IComparable.hpp"
 #include "fintamath/core/IMathObject.hpp"
+#include "fintamath/core/MathObjectIdStorage.hpp"
 #include "fintamath/expressions/Expression.hpp"
 #include "fintamath/expressions/FunctionExpression.hpp"
 #include "fintamath/expressions/IExpression.hpp"
@@ -118,6 +119,7 @@
 #include "fintamath/numbers/INumber.hpp"
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/RealBall.hpp"
 
 namespace fintamath::detail {
 
@@ -135,6 +137,8 @@ TypeConfig::TypeConfig() {
   INumber::registerType<Rational>();
   INumber::registerType<Real>();
   INumber::registerType<Complex>();
+  // Balls are produced by evaluation only and are not parsed
+  MathObjectIdStorage::add(RealBall::getClassStatic());
 
   ILiteral::registerType<IConstant>();
   ILiteral::registerType<Variable>();
@@ -253,6 +257,8 @@ TypeConfig::TypeConfig() {
   IUnaryExpression::registerType<HyperbExpr>();
   IUnaryExpression::registerType<InvHyperbExpr>();
   IUnaryExpression::registerType<NotExpr>();
+
+  MathObjectIdStorage::numberSubtrees();
 }
 
 }
@@ -1,19 +1,82 @@
 #include "fintamath/core/MathObjectIdStorage.hpp"
 
+#include <cstddef>
+#include <stack>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "fintamath/core/MathObjectClass.hpp"
+
 namespace fintamath {
 
 size_t MathObjectIdStorage::get(const MathObjectClass objClass) {
-  auto iter = getMap().find(objClass);
-  return iter != getMap().end() ? iter->second : 0;
+  return objClass->getId();
 }
 
 void MathObjectIdStorage::add(const MathObjectClass objClass) {
-  getMap().insert_or_assign(objClass, maxId++);
+  if (objClass->id == 0) {
+    getClasses().emplace_back(objClass);
+  }
+
+  objClass->id = maxId++;
+}
+
+void MathObjectIdStorage::numberSubtrees() {
+  if (areSubtreesNumbered) {
+    return;
+  }
+
+  areSubtreesNumbered = true;
+
+  std::unordered_map<MathObjectClass, std::vector<MathObjectClass>> classToChildrenMap;
+  std::unordered_set<MathObjectClass> visitedClasses;
+  std::vector<MathObjectClass> roots;
+
+  for (MathObjectClass objClass : getClasses()) {
+    // Parents become keys of the map before they are visited, so visited classes are tracked separately
+    for (MathObjectClass child = objClass; child && !visitedClasses.contains(child); child = child->getParent()) {
+      visitedClasses.emplace(child);
+
+      if (const MathObjectClass parent = child->getParent()) {
+        classToChildrenMap[parent].emplace_back(child);
+      }
+      else {
+        roots.emplace_back(child);
+      }
+    }
+  }
+
+  // Pre-order numbering starts from 1, 0 means not numbered
+  size_t index = 1;
+
+  std::stack<std::pair<MathObjectClass, size_t>> stack;
+
+  for (MathObjectClass root : roots) {
+    stack.emplace(root, 0);
+    root->subtreeBegin = index++;
+
+    while (!stack.empty()) {
+      auto &[objClass, childIndex] = stack.top();
+      const std::vector<MathObjectClass> &children = classToChildrenMap[objClass];
+
+      if (childIndex < children.size()) {
+        const MathObjectClass child = children[childIndex++];
+        child->subtreeBegin = index++;
+        stack.emplace(child, 0);
+      }
+      else {
+        objClass->subtreeEnd = index;
+        stack.pop();
+      }
+    }
+  }
 }
 
-MathObjectIdStorage::MathObjectClassToIdMap &MathObjectIdStorage::getMap() {
-  static MathObjectIdStorage::MathObjectClassToIdMap map;
-  return map;
+std::vector<MathObjectClass> &MathObjectIdStorage::getClasses() {
+  static std::vector<MathObjectClass> classes;
+  return classes;
 }
 
 }
@@ -0,0 +1,237 @@
+#include "fintamath/core/NodePool.hpp"
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+// Let sanitizers track every node
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define FINTAMATH_NODE_POOL_DISABLED
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer)
+#define FINTAMATH_NODE_POOL_DISABLED
+#endif
+#endif
+
+namespace fintamath::detail {
+
+namespace {
+
+constexpr size_t blockAlignment = alignof(std::max_align_t);
+
+constexpr size_t sizeClassesCount = NodePool::maxBlockSize / blockAlignment;
+
+constexpr size_t blocksPerChunk = 64;
+
+// Blocks are moved between the local and the shared lists in batches
+constexpr size_t blocksPerBatch = blocksPerChunk * 2;
+
+// Threads which free more blocks than they allocate return the excess to the shared lists
+constexpr size_t maxLocalBlocks = blocksPerBatch * 2;
+
+struct FreeBlock {
+  FreeBlock *next;
+};
+
+struct LocalFreeBlockList {
+  FreeBlock *blocks;
+
+  size_t size;
+};
+
+using LocalFreeBlockLists = std::array<LocalFreeBlockList, sizeClassesCount>;
+
+using SharedFreeBlockLists = std::array<FreeBlock *, sizeClassesCount>;
+
+struct SharedFreeBlocks {
+  std::mutex mutex;
+
+  SharedFreeBlockLists lists{};
+};
+
+SharedFreeBlocks &getSharedFreeBlocks() {
+  // Never destroyed as nodes can be freed during static destruction
+  static auto *shared = new SharedFreeBlocks;
+  return *shared;
+}
+
+struct LocalFreeBlocks {
+  LocalFreeBlockLists lists;
+
+  // Set when the lists are handed over on the thread exit, blocks freed after that go straight to the shared lists
+  bool isReleased;
+};
+
+// Trivially destructible, so it is still usable after the releaser below is destroyed
+thread_local LocalFreeBlocks localFreeBlocks{};
+
+// Moves up to count blocks from the front of one list to the front of another, returns the number of moved blocks
+size_t moveFreeBlocks(FreeBlock *&from, FreeBlock *&to, const size_t count) noexcept {
+  if (!from || count == 0) {
+    return 0;
+  }
+
+  FreeBlock *head = from;
+  FreeBlock *tail = head;
+  size_t moved = 1;
+
+  while (moved < count && tail->next) {
+    tail = tail->next;
+    moved++;
+  }
+
+  from = tail->next;
+  tail->next = to;
+  to = head;
+  return moved;
+}
+
+struct LocalFreeBlockListsReleaser {
+  LocalFreeBlockListsReleaser() = default;
+
+  LocalFreeBlockListsReleaser(const LocalFreeBlockListsReleaser &) = delete;
+
+  LocalFreeBlockListsReleaser &operator=(const LocalFreeBlockListsReleaser &) = delete;
+
+  ~LocalFreeBlockListsReleaser() {
+    SharedFreeBlocks &shared = getSharedFreeBlocks();
+    const std::scoped_lock lock(shared.mutex);
+
+    for (size_t i = 0; i < sizeClassesCount; i++) {
+      LocalFreeBlockList &local = localFreeBlocks.lists[i];
+      local.size -= moveFreeBlocks(local.blocks, shared.lists[i], local.size);
+    }
+
+    localFreeBlocks.isReleased = true;
+  }
+};
+
+thread_local LocalFreeBlockListsReleaser localFreeBlockListsReleaser;
+
+constexpr size_t getSizeClass(const size_t size) noexcept {
+  return (size + blockAlignment - 1) / blockAlignment - 1;
+}
+
+constexpr size_t getBlockSize(const size_t sizeClass) noexcept {
+  return (sizeClass + 1) * blockAlignment;
+}
+
+void takeSharedFreeBlocks(LocalFreeBlockList &local, const size_t sizeClass) {
+  SharedFreeBlocks &shared = getSharedFreeBlocks();
+  const std::scoped_lock lock(shared.mutex);
+
+  local.size += moveFreeBlocks(shared.lists[sizeClass], local.blocks, blocksPerBatch);
+}
+
+void giveSharedFreeBlocks(LocalFreeBlockList &local, const size_t sizeClass) noexcept {
+  SharedFreeBlocks &shared = getSharedFreeBlocks();
+  const std::scoped_lock lock(shared.mutex);
+
+  local.size -= moveFreeBlocks(local.blocks, shared.lists[sizeClass], blocksPerBatch);
+}
+
+void *takeSharedFreeBlock(const size_t sizeClass) {
+  SharedFreeBlocks &shared = getSharedFreeBlocks();
+
+  {
+    const std::scoped_lock lock(shared.mutex);
+
+    if (FreeBlock *block = shared.lists[sizeClass]) {
+      shared.lists[sizeClass] = block->next;
+      return block;
+    }
+  }
+
+  return ::operator new(getBlockSize(sizeClass));
+}
+
+void giveSharedFreeBlock(void *ptr, const size_t sizeClass) noexcept {
+  SharedFreeBlocks &shared = getSharedFreeBlocks();
+  const std::scoped_lock lock(shared.mutex);
+
+  shared.lists[sizeClass] = new (ptr) FreeBlock{shared.lists[sizeClass]};
+}
+
+FreeBlock *allocateChunk(const size_t sizeClass) {
+  const size_t blockSize = getBlockSize(sizeClass);
+
+  // Chunks are never returned to the system, the blocks circulate between free lists
+  auto *chunk = static_cast<std::byte *>(::operator new(blockSize * blocksPerChunk));
+  FreeBlock *blocks = nullptr;
+
+  for (size_t i = blocksPerChunk; i > 0; i--) {
+    auto *block = new (chunk + (i - 1) * blockSize) FreeBlock{blocks};
+    blocks = block;
+  }
+
+  return blocks;
+}
+
+}
+
+void *NodePool::allocate(const size_t size) {
+#ifndef FINTAMATH_NODE_POOL_DISABLED
+  if (size != 0 && size <= maxBlockSize) {
+    (void)&localFreeBlockListsReleaser;
+
+    const size_t sizeClass = getSizeClass(size);
+
+    // Blocks taken to the local lists after the thread exit would be lost
+    if (localFreeBlocks.isReleased) {
+      return takeSharedFreeBlock(sizeClass);
+    }
+
+    LocalFreeBlockList &local = localFreeBlocks.lists[sizeClass];
+
+    if (!local.blocks) {
+      takeSharedFreeBlocks(local, sizeClass);
+    }
+
+    if (!local.blocks) {
+      local.blocks = allocateChunk(sizeClass);
+      local.size = blocksPerChunk;
+    }
+
+    FreeBlock *block = local.blocks;
+    local.blocks = block->next;
+    local.size--;
+    return block;
+  }
+#endif
+
+  return ::operator new(size);
+}
+
+void NodePool::deallocate(void *ptr, const size_t size) noexcept {
+  if (!ptr) {
+    return;
+  }
+
+#ifndef FINTAMATH_NODE_POOL_DISABLED
+  if (size != 0 && size <= maxBlockSize) {
+    (void)&localFreeBlockListsReleaser;
+
+    const size_t sizeClass = getSizeClass(size);
+
+    if (localFreeBlocks.isReleased) {
+      giveSharedFreeBlock(ptr, sizeClass);
+      return;
+    }
+
+    LocalFreeBlockList &local = localFreeBlocks.lists[sizeClass];
+    local.blocks = new (ptr) FreeBlock{local.blocks};
+    local.size++;
+
+    if (local.size > maxLocalBlocks) {
+      giveSharedFreeBlocks(local, sizeClass);
+    }
+
+    return;
+  }
+#endif
+
+  ::operator delete(ptr);
+}
+
+}
@@ -1,93 +1,98 @@
 #include "fintamath/core/Tokenizer.hpp"
 
-#include <algorithm>
-#include <regex>
+#include <atomic>
+#include <cstddef>
 #include <string>
-
-#include "fintamath/core/CoreUtils.hpp"
+#include <string_view>
 
 namespace fintamath::detail {
 
-TokenVector Tokenizer::tokenize(std::string str) {
-  handleSpaces(str);
+namespace {
+
+std::atomic<size_t> registrationVersion = 0;
+
+}
 
+TokenVector Tokenizer::tokenize(const std::string_view str) {
   TokenVector tokens;
-  Token numberToken;
-  Token specialToken;
 
-  for (const char ch : str) {
-    if (isDigitOrPoint(ch)) {
-      appendToken(tokens, specialToken, true);
-      numberToken.push_back(ch);
+  for (size_t i = 0; i < str.size();) {
+    if (isSpace(str[i])) {
+      i++;
+      continue;
     }
-    else if (isSpace(ch)) {
-      appendToken(tokens, specialToken, true);
-      appendToken(tokens, numberToken, false);
+
+    size_t tokenSize = 0;
+
+    if (isDigitOrPoint(str[i])) {
+      while (i + tokenSize < str.size() && isDigitOrPoint(str[i + tokenSize])) {
+        tokenSize++;
+      }
     }
     else {
-      appendToken(tokens, numberToken, false);
-      specialToken.push_back(ch);
+      // The longest registered token or a single character if no one is found
+      tokenSize = findRegisteredTokenSize(str.substr(i));
+
+      if (tokenSize == 0) {
+        tokenSize = 1;
+      }
     }
-  }
 
-  appendToken(tokens, numberToken, false);
-  appendToken(tokens, specialToken, true);
+    tokens.emplace_back(str.substr(i, tokenSize));
+    i += tokenSize;
+  }
 
   return tokens;
 }
 
 void Tokenizer::registerToken(const Token &token) {
-  auto &tokens = getRegisteredTokens();
-  tokens.insert(std::ranges::upper_bound(tokens, token, [](const Token &lhs, const Token &rhs) {
-                  return lhs.size() > rhs.size();
-                }),
-                token);
-}
+  Trie &trie = getRegisteredTokens();
+  size_t nodeIndex = 0;
 
-bool Tokenizer::appendToken(TokenVector &tokens, Token &token, const bool shouldSplit) {
-  if (token.empty()) {
-    return false;
-  }
+  for (const char ch : token) {
+    if (auto iter = trie[nodeIndex].childToIndexMap.find(ch); iter != trie[nodeIndex].childToIndexMap.end()) {
+      nodeIndex = iter->second;
+      continue;
+    }
 
-  if (!shouldSplit) {
-    tokens.emplace_back(token);
-    token.clear();
-    return true;
+    trie[nodeIndex].childToIndexMap.emplace(ch, trie.size());
+    nodeIndex = trie.size();
+    trie.emplace_back();
   }
 
-  while (!token.empty()) {
-    std::string nestedToken = token.substr(0, getRegisteredTokens().front().size());
-    bool isNestedTokenFind = false;
+  trie[nodeIndex].isToken = true;
+  updateRegistrationVersion();
+}
 
-    for (const auto &registeredToken : getRegisteredTokens()) {
-      if (nestedToken.size() < registeredToken.size()) {
-        continue;
-      }
+size_t Tokenizer::getRegistrationVersion() {
+  return registrationVersion.load(std::memory_order_relaxed);
+}
 
-      if (nestedToken.size() > registeredToken.size()) {
-        nestedToken = token.substr(0, registeredToken.size());
-      }
+void Tokenizer::updateRegistrationVersion() {
+  registrationVersion.fetch_add(1, std::memory_order_relaxed);
+}
 
-      if (nestedToken == registeredToken) {
-        isNestedTokenFind = true;
-        break;
-      }
-    }
+size_t Tokenizer::findRegisteredTokenSize(const std::string_view str) {
+  const Trie &trie = getRegisteredTokens();
+  size_t nodeIndex = 0;
+  size_t tokenSize = 0;
+
+  // Tokens are matched only inside runs of special characters
+  for (size_t i = 0; i < str.size() && !isDigitOrPoint(str[i]) && !isSpace(str[i]); i++) {
+    const auto iter = trie[nodeIndex].childToIndexMap.find(str[i]);
 
-    if (!isNestedTokenFind) {
-      nestedToken = token.substr(0, 1);
+    if (iter == trie[nodeIndex].childToIndexMap.end()) {
+      break;
     }
 
-    tokens.emplace_back(nestedToken);
-    token = token.substr(nestedToken.size());
-  }
+    nodeIndex = iter->second;
 
-  token.clear();
-  return true;
-}
+    if (trie[nodeIndex].isToken) {
+      tokenSize = i + 1;
+    }
+  }
 
-void Tokenizer::handleSpaces(std::string &str) {
-  str = std::regex_replace(str, std::regex(R"([\s\r\n]+)"), " ");
+  return tokenSize;
 }
 
 bool Tokenizer::isDigitOrPoint(const char ch) {
@@ -95,11 +100,11 @@ bool Tokenizer::isDigitOrPoint(const char ch) {
 }
 
 bool Tokenizer::isSpace(const char ch) {
-  return ch == ' ';
+  return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\v' || ch == '\f' || ch == '\r';
 }
 
-TokenVector &Tokenizer::getRegisteredTokens() {
-  static TokenVector registeredTokens;
+Tokenizer::Trie &Tokenizer::getRegisteredTokens() {
+  static Trie registeredTokens(1);
   return registeredTokens;
 }
 
@@ -0,0 +1,1136 @@
+#include "fintamath/expressions/CompiledExpression.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numbers>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include "fintamath/core/Cache.hpp"
+#include "fintamath/core/Converter.hpp"
+#include "fintamath/core/MathObjectClass.hpp"
+#include "fintamath/core/MathObjectUtils.hpp"
+#include "fintamath/exceptions/InvalidInputException.hpp"
+#include "fintamath/exceptions/UndefinedException.hpp"
+#include "fintamath/expressions/Expression.hpp"
+#include "fintamath/expressions/IExpression.hpp"
+#include "fintamath/functions/FunctionArguments.hpp"
+#include "fintamath/functions/IFunction.hpp"
+#include "fintamath/functions/arithmetic/Abs.hpp"
+#include "fintamath/functions/arithmetic/Add.hpp"
+#include "fintamath/functions/arithmetic/AddOper.hpp"
+#include "fintamath/functions/arithmetic/Div.hpp"
+#include "fintamath/functions/arithmetic/Frac.hpp"
+#include "fintamath/functions/arithmetic/Mul.hpp"
+#include "fintamath/functions/arithmetic/MulOper.hpp"
+#include "fintamath/functions/arithmetic/Neg.hpp"
+#include "fintamath/functions/arithmetic/Sub.hpp"
+#include "fintamath/functions/hyperbolic/Acosh.hpp"
+#include "fintamath/functions/hyperbolic/Acoth.hpp"
+#include "fintamath/functions/hyperbolic/Acsch.hpp"
+#include "fintamath/functions/hyperbolic/Asech.hpp"
+#include "fintamath/functions/hyperbolic/Asinh.hpp"
+#include "fintamath/functions/hyperbolic/Atanh.hpp"
+#include "fintamath/functions/hyperbolic/Cosh.hpp"
+#include "fintamath/functions/hyperbolic/Coth.hpp"
+#include "fintamath/functions/hyperbolic/Csch.hpp"
+#include "fintamath/functions/hyperbolic/Sech.hpp"
+#include "fintamath/functions/hyperbolic/Sinh.hpp"
+#include "fintamath/functions/hyperbolic/Tanh.hpp"
+#include "fintamath/functions/logarithms/Lb.hpp"
+#include "fintamath/functions/logarithms/Lg.hpp"
+#include "fintamath/functions/logarithms/Ln.hpp"
+#include "fintamath/functions/logarithms/Log.hpp"
+#include "fintamath/functions/ntheory/Ceil.hpp"
+#include "fintamath/functions/ntheory/Floor.hpp"
+#include "fintamath/functions/other/Factorial.hpp"
+#include "fintamath/functions/powers/Exp.hpp"
+#include "fintamath/functions/powers/Pow.hpp"
+#include "fintamath/functions/powers/PowOper.hpp"
+#include "fintamath/functions/powers/Sqrt.hpp"
+#include "fintamath/functions/trigonometry/Acos.hpp"
+#include "fintamath/functions/trigonometry/Acot.hpp"
+#include "fintamath/functions/trigonometry/Acsc.hpp"
+#include "fintamath/functions/trigonometry/Asec.hpp"
+#include "fintamath/functions/trigonometry/Asin.hpp"
+#include "fintamath/functions/trigonometry/Atan.hpp"
+#include "fintamath/functions/trigonometry/Cos.hpp"
+#include "fintamath/functions/trigonometry/Cot.hpp"
+#include "fintamath/functions/trigonometry/Csc.hpp"
+#include "fintamath/functions/trigonometry/Sec.hpp"
+#include "fintamath/functions/trigonometry/Sin.hpp"
+#include "fintamath/functions/trigonometry/Tan.hpp"
+#include "fintamath/literals/Variable.hpp"
+#include "fintamath/literals/constants/IConstant.hpp"
+#include "fintamath/numbers/INumber.hpp"
+#include "fintamath/numbers/Integer.hpp"
+#include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
+#include "fintamath/numbers/RealFunctions.hpp"
+
+namespace fintamath {
+
+using namespace detail;
+
+using Operation = CompiledExpression::Operation;
+
+namespace {
+
+std::optional<Operation> findOperation(const std::shared_ptr<IFunction> &func) {
+  static const std::unordered_map<MathObjectClass, Operation> classToOperationMap = {
+      {Add::getClassStatic(), Operation::Add},
+      {AddOper::getClassStatic(), Operation::Add},
+      {Sub::getClassStatic(), Operation::Sub},
+      {Mul::getClassStatic(), Operation::Mul},
+      {MulOper::getClassStatic(), Operation::Mul},
+      {Div::getClassStatic(), Operation::Div},
+      {Frac::getClassStatic(), Operation::Div},
+      {Neg::getClassStatic(), Operation::Neg},
+      {Abs::getClassStatic(), Operation::Abs},
+      {Pow::getClassStatic(), Operation::Pow},
+      {PowOper::getClassStatic(), Operation::Pow},
+      {Sqrt::getClassStatic(), Operation::Sqrt},
+      {Exp::getClassStatic(), Operation::Exp},
+      {Log::getClassStatic(), Operation::Log},
+      {Ln::getClassStatic(), Operation::Ln},
+      {Lb::getClassStatic(), Operation::Lb},
+      {Lg::getClassStatic(), Operation::Lg},
+      {Sin::getClassStatic(), Operation::Sin},
+      {Cos::getClassStatic(), Operation::Cos},
+      {Tan::getClassStatic(), Operation::Tan},
+      {Cot::getClassStatic(), Operation::Cot},
+      {Sec::getClassStatic(), Operation::Sec},
+      {Csc::getClassStatic(), Operation::Csc},
+      {Asin::getClassStatic(), Operation::Asin},
+      {Acos::getClassStatic(), Operation::Acos},
+      {Atan::getClassStatic(), Operation::Atan},
+      {Acot::getClassStatic(), Operation::Acot},
+      {Asec::getClassStatic(), Operation::Asec},
+      {Acsc::getClassStatic(), Operation::Acsc},
+      {Sinh::getClassStatic(), Operation::Sinh},
+      {Cosh::getClassStatic(), Operation::Cosh},
+      {Tanh::getClassStatic(), Operation::Tanh},
+      {Coth::getClassStatic(), Operation::Coth},
+      {Sech::getClassStatic(), Operation::Sech},
+      {Csch::getClassStatic(), Operation::Csch},
+      {Asinh::getClassStatic(), Operation::Asinh},
+      {Acosh::getClassStatic(), Operation::Acosh},
+      {Atanh::getClassStatic(), Operation::Atanh},
+      {Acoth::getClassStatic(), Operation::Acoth},
+      {Asech::getClassStatic(), Operation::Asech},
+      {Acsch::getClassStatic(), Operation::Acsch},
+      {Floor::getClassStatic(), Operation::Floor},
+      {Ceil::getClassStatic(), Operation::Ceil},
+      {Factorial::getClassStatic(), Operation::Factorial},
+  };
+
+  if (!func) {
+    return {};
+  }
+
+  if (const auto factorial = cast<Factorial>(func); factorial && factorial->getOrder() != 1) {
+    return {};
+  }
+
+  if (const auto iter = classToOperationMap.find(func->getClass()); iter != classToOperationMap.end()) {
+    return iter->second;
+  }
+
+  return {};
+}
+
+bool isArgumentsSizeValid(const Operation operation, const size_t argumentsSize) {
+  switch (operation) {
+    case Operation::Add:
+    case Operation::Mul:
+      return argumentsSize != 0;
+    case Operation::Sub:
+    case Operation::Div:
+    case Operation::Pow:
+    case Operation::Log:
+      return argumentsSize == 2;
+    default:
+      return argumentsSize == 1;
+  }
+}
+
+bool isConstant(const ArgumentPtr &arg) {
+  if (const auto num = cast<INumber>(arg)) {
+    return isConvertible<Real>(*num);
+  }
+
+  if (const auto constant = cast<IConstant>(arg)) {
+    return constant->getReturnClass() == Real::getClassStatic();
+  }
+
+  return false;
+}
+
+Real toReal(const ArgumentPtr &arg) {
+  if (const auto constant = cast<IConstant>(arg)) {
+    return cast<Real>(*(*constant)());
+  }
+
+  return *convert<Real>(*arg);
+}
+
+std::optional<Real> toReal(const std::optional<Integer> &rhs) {
+  if (!rhs) {
+    return {};
+  }
+
+  return Real(*rhs);
+}
+
+std::optional<Real> evaluateUnary(const Operation operation, const Real &rhs) {
+  switch (operation) {
+    case Operation::Neg:
+      return -rhs;
+    case Operation::Abs:
+      return abs(rhs);
+    case Operation::Sqrt:
+      return trySqrt(rhs);
+    case Operation::Exp:
+      return tryExp(rhs);
+    case Operation::Ln:
+      return tryLn(rhs);
+    case Operation::Lb:
+      return tryLb(rhs);
+    case Operation::Lg:
+      return tryLg(rhs);
+    case Operation::Sin:
+      return trySin(rhs);
+    case Operation::Cos:
+      return tryCos(rhs);
+    case Operation::Tan:
+      return tryTan(rhs);
+    case Operation::Cot:
+      return tryCot(rhs);
+    case Operation::Sec:
+      return trySec(rhs);
+    case Operation::Csc:
+      return tryCsc(rhs);
+    case Operation::Asin:
+      return tryAsin(rhs);
+    case Operation::Acos:
+      return tryAcos(rhs);
+    case Operation::Atan:
+      return tryAtan(rhs);
+    case Operation::Acot:
+      return tryAcot(rhs);
+    case Operation::Asec:
+      return tryAsec(rhs);
+    case Operation::Acsc:
+      return tryAcsc(rhs);
+    case Operation::Sinh:
+      return trySinh(rhs);
+    case Operation::Cosh:
+      return tryCosh(rhs);
+    case Operation::Tanh:
+      return tryTanh(rhs);
+    case Operation::Coth:
+      return tryCoth(rhs);
+    case Operation::Sech:
+      return trySech(rhs);
+    case Operation::Csch:
+      return tryCsch(rhs);
+    case Operation::Asinh:
+      return tryAsinh(rhs);
+    case Operation::Acosh:
+      return tryAcosh(rhs);
+    case Operation::Atanh:
+      return tryAtanh(rhs);
+    case Operation::Acoth:
+      return tryAcoth(rhs);
+    case Operation::Asech:
+      return tryAsech(rhs);
+    case Operation::Acsch:
+      return tryAcsch(rhs);
+    case Operation::Floor:
+      return toReal(tryFloor(rhs));
+    case Operation::Ceil:
+      return toReal(tryCeil(rhs));
+    case Operation::Factorial:
+      return tryTgamma(rhs + 1);
+    default:
+      return {};
+  }
+}
+
+std::optional<Real> evaluateBinary(const Operation operation, const Real &lhs, const Real &rhs) {
+  switch (operation) {
+    case Operation::Sub:
+      return lhs - rhs;
+    case Operation::Div:
+      if (rhs.isZero()) {
+        return {};
+      }
+
+      return lhs / rhs;
+    case Operation::Pow:
+      return tryPow(lhs, rhs);
+    case Operation::Log:
+      return tryLog(lhs, rhs);
+    default:
+      return {};
+  }
+}
+
+// Computed constants are only correct to the last digit, a ball of a Real covers one ulp of it
+RealBall toRealBall(const ArgumentPtr &arg) {
+  if (const auto constant = cast<IConstant>(arg)) {
+    return RealBall(cast<Real>(*(*constant)()));
+  }
+
+  return *convert<RealBall>(*arg);
+}
+
+std::optional<RealBall> toRealBall(const std::optional<Integer> &rhs) {
+  if (!rhs) {
+    return {};
+  }
+
+  return RealBall(*rhs);
+}
+
+std::optional<RealBall> evaluateUnary(const Operation operation, const RealBall &rhs) {
+  switch (operation) {
+    case Operation::Neg:
+      return -rhs;
+    case Operation::Abs:
+      return abs(rhs);
+    case Operation::Sqrt:
+      return trySqrt(rhs);
+    case Operation::Exp:
+      return tryExp(rhs);
+    case Operation::Ln:
+      return tryLn(rhs);
+    case Operation::Lb:
+      return tryLb(rhs);
+    case Operation::Lg:
+      return tryLg(rhs);
+    case Operation::Sin:
+      return trySin(rhs);
+    case Operation::Cos:
+      return tryCos(rhs);
+    case Operation::Tan:
+      return tryTan(rhs);
+    case Operation::Cot:
+      return tryCot(rhs);
+    case Operation::Sec:
+      return trySec(rhs);
+    case Operation::Csc:
+      return tryCsc(rhs);
+    case Operation::Asin:
+      return tryAsin(rhs);
+    case Operation::Acos:
+      return tryAcos(rhs);
+    case Operation::Atan:
+      return tryAtan(rhs);
+    case Operation::Acot:
+      return tryAcot(rhs);
+    case Operation::Asec:
+      return tryAsec(rhs);
+    case Operation::Acsc:
+      return tryAcsc(rhs);
+    case Operation::Sinh:
+      return trySinh(rhs);
+    case Operation::Cosh:
+      return tryCosh(rhs);
+    case Operation::Tanh:
+      return tryTanh(rhs);
+    case Operation::Coth:
+      return tryCoth(rhs);
+    case Operation::Sech:
+      return trySech(rhs);
+    case Operation::Csch:
+      return tryCsch(rhs);
+    case Operation::Asinh:
+      return tryAsinh(rhs);
+    case Operation::Acosh:
+      return tryAcosh(rhs);
+    case Operation::Atanh:
+      return tryAtanh(rhs);
+    case Operation::Acoth:
+      return tryAcoth(rhs);
+    case Operation::Asech:
+      return tryAsech(rhs);
+    case Operation::Acsch:
+      return tryAcsch(rhs);
+    case Operation::Floor:
+      return toRealBall(tryFloor(rhs));
+    case Operation::Ceil:
+      return toRealBall(tryCeil(rhs));
+    default:
+      return {};
+  }
+}
+
+std::optional<RealBall> evaluateBinary(const Operation operation, const RealBall &lhs, const RealBall &rhs) {
+  switch (operation) {
+    case Operation::Sub:
+      return lhs - rhs;
+    case Operation::Div:
+      if (rhs.containsZero()) {
+        return {};
+      }
+
+      return lhs / rhs;
+    case Operation::Pow:
+      return tryPow(lhs, rhs);
+    case Operation::Log:
+      return tryLog(lhs, rhs);
+    default:
+      return {};
+  }
+}
+
+// Points are evaluated in blocks, so the kernels run over short contiguous arrays the compiler can vectorize
+constexpr size_t batchBlockSize = 256;
+
+constexpr double undefinedValue = std::numeric_limits<double>::quiet_NaN();
+
+template <typename Function>
+void applyUnary(double *rhs, const size_t size, const Function &func) {
+  for (size_t i = 0; i < size; i++) {
+    rhs[i] = func(rhs[i]);
+  }
+}
+
+template <typename Function>
+void applyBinary(double *lhs, const double *rhs, const size_t size, const Function &func) {
+  for (size_t i = 0; i < size; i++) {
+    lhs[i] = func(lhs[i], rhs[i]);
+  }
+}
+
+double inverse(const double rhs) {
+  return rhs == 0 ? undefinedValue : 1 / rhs;
+}
+
+void evaluateUnaryBatch(const Operation operation, double *rhs, const size_t size) {
+  switch (operation) {
+    case Operation::Neg:
+      return applyUnary(rhs, size, std::negate<>{});
+    case Operation::Abs:
+      return applyUnary(rhs, size, [](const double x) { return std::abs(x); });
+    case Operation::Sqrt:
+      return applyUnary(rhs, size, [](const double x) { return std::sqrt(x); });
+    case Operation::Exp:
+      return applyUnary(rhs, size, [](const double x) { return std::exp(x); });
+    case Operation::Ln:
+      return applyUnary(rhs, size, [](const double x) { return std::log(x); });
+    case Operation::Lb:
+      return applyUnary(rhs, size, [](const double x) { return std::log2(x); });
+    case Operation::Lg:
+      return applyUnary(rhs, size, [](const double x) { return std::log10(x); });
+    case Operation::Sin:
+      return applyUnary(rhs, size, [](const double x) { return std::sin(x); });
+    case Operation::Cos:
+      return applyUnary(rhs, size, [](const double x) { return std::cos(x); });
+    case Operation::Tan:
+      return applyUnary(rhs, size, [](const double x) { return std::tan(x); });
+    case Operation::Cot:
+      return applyUnary(rhs, size, [](const double x) { return inverse(std::tan(x)); });
+    case Operation::Sec:
+      return applyUnary(rhs, size, [](const double x) { return inverse(std::cos(x)); });
+    case Operation::Csc:
+      return applyUnary(rhs, size, [](const double x) { return inverse(std::sin(x)); });
+    case Operation::Asin:
+      return applyUnary(rhs, size, [](const double x) { return std::asin(x); });
+    case Operation::Acos:
+      return applyUnary(rhs, size, [](const double x) { return std::acos(x); });
+    case Operation::Atan:
+      return applyUnary(rhs, size, [](const double x) { return std::atan(x); });
+    case Operation::Acot:
+      return applyUnary(rhs, size, [](const double x) { return std::atan(inverse(x)); });
+    case Operation::Asec:
+      return applyUnary(rhs, size, [](const double x) { return std::acos(inverse(x)); });
+    case Operation::Acsc:
+      return applyUnary(rhs, size, [](const double x) { return std::asin(inverse(x)); });
+    case Operation::Sinh:
+      return applyUnary(rhs, size, [](const double x) { return std::sinh(x); });
+    case Operation::Cosh:
+      return applyUnary(rhs, size, [](const double x) { return std::cosh(x); });
+    case Operation::Tanh:
+      return applyUnary(rhs, size, [](const double x) { return std::tanh(x); });
+    case Operation::Coth:
+      return applyUnary(rhs, size, [](const double x) { return inverse(std::tanh(x)); });
+    case Operation::Sech:
+      return applyUnary(rhs, size, [](const double x) { return inverse(std::cosh(x)); });
+    case Operation::Csch:
+      return applyUnary(rhs, size, [](const double x) { return inverse(std::sinh(x)); });
+    case Operation::Asinh:
+      return applyUnary(rhs, size, [](const double x) { return std::asinh(x); });
+    case Operation::Acosh:
+      return applyUnary(rhs, size, [](const double x) { return std::acosh(x); });
+    case Operation::Atanh:
+      return applyUnary(rhs, size, [](const double x) { return std::atanh(x); });
+    case Operation::Acoth:
+      return applyUnary(rhs, size, [](const double x) { return std::atanh(inverse(x)); });
+    case Operation::Asech:
+      return applyUnary(rhs, size, [](const double x) { return std::acosh(inverse(x)); });
+    case Operation::Acsch:
+      return applyUnary(rhs, size, [](const double x) { return std::asinh(inverse(x)); });
+    case Operation::Floor:
+      return applyUnary(rhs, size, [](const double x) { return std::floor(x); });
+    case Operation::Ceil:
+      return applyUnary(rhs, size, [](const double x) { return std::ceil(x); });
+    case Operation::Factorial:
+      return applyUnary(rhs, size, [](const double x) { return std::tgamma(x + 1); });
+    default:
+      return applyUnary(rhs, size, [](const double /*x*/) { return undefinedValue; });
+  }
+}
+
+void evaluateBinaryBatch(const Operation operation, double *lhs, const double *rhs, const size_t size) {
+  switch (operation) {
+    case Operation::Sub:
+      return applyBinary(lhs, rhs, size, std::minus<>{});
+    case Operation::Div:
+      return applyBinary(lhs, rhs, size, std::divides<>{});
+    case Operation::Pow:
+      return applyBinary(lhs, rhs, size, [](const double x, const double y) {
+        return x == 0 && y == 0 ? undefinedValue : std::pow(x, y);
+      });
+    case Operation::Log:
+      return applyBinary(lhs, rhs, size, [](const double x, const double y) {
+        return std::log(y) / std::log(x);
+      });
+    default:
+      return applyBinary(lhs, rhs, size, [](const double /*x*/, const double /*y*/) { return undefinedValue; });
+  }
+}
+
+void updateUndefinedMask(const double *values, uint8_t *undefinedMask, const size_t size) {
+  for (size_t i = 0; i < size; i++) {
+    undefinedMask[i] |= static_cast<uint8_t>(!std::isfinite(values[i]));
+  }
+}
+
+constexpr double unitRoundoff = std::numeric_limits<double>::epsilon() / 2;
+
+// Standard library functions are not correctly rounded, a few ulps are allowed for them
+constexpr double functionRoundoff = 8 * unitRoundoff;
+
+// Error bounds are computed in round-to-nearest by a few operations each,
+// they are enlarged by this factor, so the rounding of the bound can not make it smaller than the real error
+constexpr double errorBoundFactor = 1 + 16 * unitRoundoff;
+
+// Double value with a bound of its absolute error
+struct TrackedDouble {
+  double value = 0;
+
+  double error = 0;
+};
+
+std::optional<TrackedDouble> makeTrackedDouble(const double value, const double error) {
+  if (!std::isfinite(value) || !std::isfinite(error)) {
+    return {};
+  }
+
+  return TrackedDouble{value, error * errorBoundFactor};
+}
+
+std::optional<TrackedDouble> trackedAdd(const TrackedDouble &lhs, const TrackedDouble &rhs) {
+  const double value = lhs.value + rhs.value;
+  return makeTrackedDouble(value, lhs.error + rhs.error + unitRoundoff * std::abs(value));
+}
+
+std::optional<TrackedDouble> trackedSub(const TrackedDouble &lhs, const TrackedDouble &rhs) {
+  const double value = lhs.value - rhs.value;
+  return makeTrackedDouble(value, lhs.error + rhs.error + unitRoundoff * std::abs(value));
+}
+
+std::optional<TrackedDouble> trackedMul(const TrackedDouble &lhs, const TrackedDouble &rhs) {
+  const double value = lhs.value * rhs.value;
+  const double error = std::abs(lhs.value) * rhs.error + std::abs(rhs.value) * lhs.error + lhs.error * rhs.error;
+  return makeTrackedDouble(value, error + unitRoundoff * std::abs(value));
+}
+
+std::optional<TrackedDouble> trackedDiv(const TrackedDouble &lhs, const TrackedDouble &rhs) {
+  const double rhsAbs = std::abs(rhs.value);
+
+  if (rhsAbs <= rhs.error) {
+    return {};
+  }
+
+  const double value = lhs.value / rhs.value;
+  const double error = (std::abs(lhs.value) * rhs.error + rhsAbs * lhs.error) / (rhsAbs * (rhsAbs - rhs.error));
+  return makeTrackedDouble(value, error + unitRoundoff * std::abs(value));
+}
+
+std::optional<TrackedDouble> trackedSqrt(const TrackedDouble &rhs) {
+  const double lowerBound = rhs.value - rhs.error;
+
+  if (lowerBound <= 0) {
+    return {};
+  }
+
+  const double value = std::sqrt(rhs.value);
+  return makeTrackedDouble(value, rhs.error / (std::sqrt(lowerBound) + value) + unitRoundoff * value);
+}
+
+// Absolute error of ln(rhs) divided by ln(base)
+std::optional<TrackedDouble> trackedLog(const TrackedDouble &rhs, const double value, const double lnBase) {
+  const double lowerBound = rhs.value - rhs.error;
+
+  if (lowerBound <= 0) {
+    return {};
+  }
+
+  return makeTrackedDouble(value, rhs.error / lowerBound / lnBase + functionRoundoff * std::abs(value));
+}
+
+std::optional<TrackedDouble> trackedPow(const TrackedDouble &lhs, const TrackedDouble &rhs) {
+  const double lhsAbs = std::abs(lhs.value);
+
+  // Negative bases are defined only for exact integer exponents
+  if (lhsAbs <= lhs.error || (lhs.value < 0 && (rhs.error != 0 || std::trunc(rhs.value) != rhs.value))) {
+    return {};
+  }
+
+  const double value = std::pow(lhs.value, rhs.value);
+
+  // Error of ln(value) = rhs * ln(lhs), which turns into a relative error of value
+  const double lnError = (std::abs(rhs.value) + rhs.error) * lhs.error / (lhsAbs - lhs.error) +
+                         std::abs(std::log(lhsAbs)) * rhs.error;
+
+  return makeTrackedDouble(value, 2 * std::abs(value) * std::expm1(lnError) + functionRoundoff * std::abs(value));
+}
+
+std::optional<TrackedDouble> evaluateTracked(const Operation operation, const TrackedDouble &rhs) {
+  switch (operation) {
+    case Operation::Neg:
+      return TrackedDouble{-rhs.value, rhs.error};
+    case Operation::Abs:
+      return TrackedDouble{std::abs(rhs.value), rhs.error};
+    case Operation::Sqrt:
+      return trackedSqrt(rhs);
+    case Operation::Exp: {
+      const double value = std::exp(rhs.value);
+      return makeTrackedDouble(value, 2 * value * std::expm1(rhs.error) + functionRoundoff * value);
+    }
+    case Operation::Ln:
+      return trackedLog(rhs, std::log(rhs.value), 1);
+    case Operation::Lb:
+      return trackedLog(rhs, std::log2(rhs.value), std::numbers::ln2);
+    case Operation::Lg:
+      return trackedLog(rhs, std::log10(rhs.value), std::numbers::ln10);
+    case Operation::Sin: {
+      const double value = std::sin(rhs.value);
+      return makeTrackedDouble(value, std::min(rhs.error, 2.0) + functionRoundoff * std::abs(value));
+    }
+    case Operation::Cos: {
+      const double value = std::cos(rhs.value);
+      return makeTrackedDouble(value, std::min(rhs.error, 2.0) + functionRoundoff * std::abs(value));
+    }
+    case Operation::Atan: {
+      const double value = std::atan(rhs.value);
+      return makeTrackedDouble(value, rhs.error + functionRoundoff * std::abs(value));
+    }
+    default:
+      return {};
+  }
+}
+
+std::optional<TrackedDouble> evaluateTracked(const Operation operation, const TrackedDouble &lhs, const TrackedDouble &rhs) {
+  switch (operation) {
+    case Operation::Sub:
+      return trackedSub(lhs, rhs);
+    case Operation::Div:
+      return trackedDiv(lhs, rhs);
+    case Operation::Pow:
+      return trackedPow(lhs, rhs);
+    case Operation::Log: {
+      const auto lnLhs = evaluateTracked(Operation::Ln, lhs);
+      const auto lnRhs = evaluateTracked(Operation::Ln, rhs);
+
+      if (!lnLhs || !lnRhs) {
+        return {};
+      }
+
+      return trackedDiv(*lnRhs, *lnLhs);
+    }
+    default:
+      return {};
+  }
+}
+
+// Whether every value within the error bound rounds to the same number of the given significant digits
+bool isRoundingStable(const double value, const double error, const unsigned precision) {
+  if (value == 0 || precision > std::numeric_limits<double>::digits10) {
+    return false;
+  }
+
+  const double valueAbs = std::abs(value);
+  const int exponent = static_cast<int>(std::floor(std::log10(valueAbs))) - static_cast<int>(precision) + 1;
+  const double scaled = valueAbs * std::pow(10.0, -exponent);
+
+  // Includes rounding errors of the scaling itself
+  const double scaledError = (error * std::pow(10.0, -exponent) + 4 * std::numeric_limits<double>::epsilon() * scaled) * errorBoundFactor;
+
+  const double minScaled = std::pow(10.0, precision - 1);
+  const double maxScaled = std::pow(10.0, precision) - 0.5;
+
+  return std::isfinite(scaled) &&
+         std::isfinite(scaledError) &&
+         scaled - scaledError >= minScaled &&
+         scaled + scaledError < maxScaled &&
+         std::abs(scaled - std::round(scaled)) + scaledError < 0.5;
+}
+
+// Rounding to these bits keeps the value within its error, so its rounding stable digits do not change
+mpfr_prec_t getCertainBits(const double value, const double error) {
+  if (error == 0) {
+    return std::numeric_limits<double>::digits;
+  }
+
+  return std::clamp<mpfr_prec_t>(std::ilogb(value) - std::ilogb(error), MPFR_PREC_MIN, std::numeric_limits<double>::digits);
+}
+
+}
+
+CompiledExpression::CompiledExpression(const Expression &expr)
+    : CompiledExpression(expr, [&expr] {
+        const auto vars = expr.getVariables();
+        return std::vector<Variable>(vars.begin(), vars.end());
+      }()) {
+}
+
+CompiledExpression::CompiledExpression(const Expression &expr, std::vector<Variable> inVariables)
+    : variables(std::move(inVariables)),
+      exprString(expr.toString()) {
+
+  size_t stackSize = 0;
+  compile(expr.getChildren().front(), stackSize);
+
+  precisionToConstantValuesCache = std::make_shared<Cache<unsigned, std::vector<Real>>>(
+      [inConstants = constants](const unsigned /*precision*/) {
+        std::vector<Real> values;
+        values.reserve(inConstants.size());
+
+        for (const auto &constant : inConstants) {
+          values.emplace_back(toReal(constant));
+        }
+
+        return values;
+      });
+
+  const Real::ScopedSetPrecision setPrecision(std::numeric_limits<double>::max_digits10);
+
+  for (const auto &constant : constants) {
+    const Real constantValue = toReal(constant);
+    const auto constantDoubleValue = constantValue.getBackend().convert_to<double>();
+
+    constantDoubleValues.emplace_back(constantDoubleValue);
+    constantDoubleErrors.emplace_back(constantValue.getBackend() == constantDoubleValue
+                                          ? 0
+                                          : 2 * unitRoundoff * std::abs(constantDoubleValue));
+  }
+}
+
+const std::vector<Variable> &CompiledExpression::getVariables() const noexcept {
+  return variables;
+}
+
+const std::vector<CompiledExpression::Instruction> &CompiledExpression::getInstructions() const noexcept {
+  return instructions;
+}
+
+const ArgumentPtrVector &CompiledExpression::getConstants() const noexcept {
+  return constants;
+}
+
+size_t CompiledExpression::getMaxStackSize() const noexcept {
+  return maxStackSize;
+}
+
+Real CompiledExpression::evaluate(const std::vector<Real> &values, const unsigned precision) const {
+  validateValues(values);
+
+  const Real::ScopedSetPrecision setPrecision(precision);
+
+  // Both evaluation tiers give the result with the precision of the least precise input
+  const unsigned outputPrecision = getOutputPrecision(values);
+
+  if (auto res = evaluateDouble(values, outputPrecision)) {
+    return std::move(*res);
+  }
+
+  // Constants are computed by the cache under the precision set above
+  const std::vector<Real> &constantValues = (*precisionToConstantValuesCache)[precision];
+
+  std::vector<Real> stack;
+  stack.reserve(maxStackSize);
+
+  for (const auto &[operation, argument] : instructions) {
+    switch (operation) {
+      case Operation::Constant: {
+        stack.emplace_back(constantValues[argument]);
+        break;
+      }
+      case Operation::Variable: {
+        stack.emplace_back(values[argument]);
+        break;
+      }
+      case Operation::Add:
+      case Operation::Mul: {
+        const auto first = stack.end() - static_cast<std::ptrdiff_t>(argument);
+
+        for (auto iter = first + 1; iter != stack.end(); ++iter) {
+          if (operation == Operation::Add) {
+            *first += *iter;
+          }
+          else {
+            *first *= *iter;
+          }
+        }
+
+        stack.erase(first + 1, stack.end());
+        break;
+      }
+      default: {
+        std::optional<Real> res = argument == 1
+                                      ? evaluateUnary(operation, stack.back())
+                                      : evaluateBinary(operation, stack[stack.size() - 2], stack.back());
+
+        if (!res) {
+          throw UndefinedException(fmt::format(
+              R"({} is undefined for the given values)",
+              exprString));
+        }
+
+        stack.resize(stack.size() - argument);
+        stack.emplace_back(std::move(*res));
+        break;
+      }
+    }
+  }
+
+  Real res = std::move(stack.back());
+  res.setPrecision(outputPrecision);
+  return res;
+}
+
+std::optional<Real> CompiledExpression::evaluateCertified(const std::vector<Real> &values, const unsigned precision) const {
+  validateValues(values);
+
+  // Gamma function has no error bounds
+  if (std::ranges::any_of(instructions, [](const Instruction &inst) { return inst.operation == Operation::Factorial; })) {
+    return {};
+  }
+
+  for (unsigned workPrecision = std::max(precision / 2, 1U); workPrecision <= precision * maxPrecisionGrowth; workPrecision *= 2) {
+    std::optional<RealBall> res;
+
+    try {
+      const Real::ScopedSetPrecision setPrecision(workPrecision);
+      res = evaluateBall(values);
+    }
+    catch (const UndefinedException &) {
+      // Overflow, which may disappear with more precision of the intermediate values
+    }
+
+    if (res && *res->getPrecision() >= precision) {
+      const Real::ScopedSetPrecision setPrecision(precision);
+      return Real(Real::Backend(res->getMidpoint(), Real::getCalculationPrecisionStatic()));
+    }
+  }
+
+  return {};
+}
+
+void CompiledExpression::validateValues(const std::vector<Real> &values) const {
+  if (values.size() != variables.size()) {
+    throw InvalidInputException(fmt::format(
+        R"(Unable to evaluate "{}" with {} values (expected {}))",
+        exprString,
+        values.size(),
+        variables.size()));
+  }
+}
+
+unsigned CompiledExpression::getOutputPrecision(const std::vector<Real> &values) const {
+  unsigned precision = Real::getPrecisionStatic();
+
+  for (const auto &value : values) {
+    precision = std::min(precision, *value.getPrecision());
+  }
+
+  for (const auto &constant : constants) {
+    if (const auto num = cast<INumber>(constant); num && num->getPrecision()) {
+      precision = std::min(precision, *num->getPrecision());
+    }
+  }
+
+  return precision;
+}
+
+std::optional<Real> CompiledExpression::evaluateDouble(const std::vector<Real> &values, const unsigned precision) const {
+  if (precision > maxDoublePrecision) {
+    return {};
+  }
+
+  std::vector<TrackedDouble> stack;
+  stack.reserve(maxStackSize);
+
+  for (const auto &[operation, argument] : instructions) {
+    std::optional<TrackedDouble> res;
+
+    switch (operation) {
+      case Operation::Constant: {
+        res = TrackedDouble{constantDoubleValues[argument], constantDoubleErrors[argument]};
+        break;
+      }
+      case Operation::Variable: {
+        const Real::Backend &backend = values[argument].getBackend();
+        const auto value = backend.convert_to<double>();
+        res = makeTrackedDouble(value, backend == value ? 0 : unitRoundoff * std::abs(value));
+        break;
+      }
+      case Operation::Add:
+      case Operation::Mul: {
+        const auto first = stack.end() - static_cast<std::ptrdiff_t>(argument);
+        res = *first;
+
+        for (auto iter = first + 1; iter != stack.end() && res; ++iter) {
+          res = operation == Operation::Add ? trackedAdd(*res, *iter) : trackedMul(*res, *iter);
+        }
+
+        stack.erase(first, stack.end());
+        break;
+      }
+      default: {
+        res = argument == 1
+                  ? evaluateTracked(operation, stack.back())
+                  : evaluateTracked(operation, stack[stack.size() - 2], stack.back());
+
+        stack.resize(stack.size() - argument);
+        break;
+      }
+    }
+
+    if (!res) {
+      return {};
+    }
+
+    stack.emplace_back(*res);
+  }
+
+  const auto [value, error] = stack.back();
+
+  if (!isRoundingStable(value, error, precision)) {
+    return {};
+  }
+
+  // The backend does not claim the calculation precision, it keeps only the bits which are not lost in the error
+  Real::Backend backend = value;
+  mpfr_prec_round(backend.backend().data(), getCertainBits(value, error), MPFR_RNDN);
+
+  Real res = std::move(backend);
+  res.setPrecision(precision);
+  return res;
+}
+
+std::optional<RealBall> CompiledExpression::evaluateBall(const std::vector<Real> &values) const {
+  std::vector<RealBall> stack;
+  stack.reserve(maxStackSize);
+
+  for (const auto &[operation, argument] : instructions) {
+    switch (operation) {
+      case Operation::Constant: {
+        stack.emplace_back(toRealBall(constants[argument]));
+        break;
+      }
+      case Operation::Variable: {
+        stack.emplace_back(values[argument]);
+        break;
+      }
+      case Operation::Add:
+      case Operation::Mul: {
+        const auto first = stack.end() - static_cast<std::ptrdiff_t>(argument);
+
+        for (auto iter = first + 1; iter != stack.end(); ++iter) {
+          if (operation == Operation::Add) {
+            *first += *iter;
+          }
+          else {
+            *first *= *iter;
+          }
+        }
+
+        stack.erase(first + 1, stack.end());
+        break;
+      }
+      default: {
+        std::optional<RealBall> res = argument == 1
+                                          ? evaluateUnary(operation, stack.back())
+                                          : evaluateBinary(operation, stack[stack.size() - 2], stack.back());
+
+        if (!res) {
+          return {};
+        }
+
+        stack.resize(stack.size() - argument);
+        stack.emplace_back(std::move(*res));
+        break;
+      }
+    }
+  }
+
+  return std::move(stack.back());
+}
+
+CompiledExpression::BatchResult CompiledExpression::evaluateBatch(const std::vector<std::vector<double>> &columns) const {
+  if (columns.size() != variables.size()) {
+    throw InvalidInputException(fmt::format(
+        R"(Unable to evaluate "{}" with {} columns (expected {}))",
+        exprString,
+        columns.size(),
+        variables.size()));
+  }
+
+  const size_t pointsCount = columns.empty() ? 1 : columns.front().size();
+
+  if (std::ranges::any_of(columns, [pointsCount](const auto &column) { return column.size() != pointsCount; })) {
+    throw InvalidInputException(fmt::format(
+        R"(Unable to evaluate "{}" with columns of different sizes)",
+        exprString));
+  }
+
+  BatchResult res;
+  res.values.resize(pointsCount);
+  res.undefinedMask.resize(pointsCount);
+
+  std::vector<double> stack(maxStackSize * batchBlockSize);
+
+  const auto getSlot = [&stack](const size_t index) {
+    return stack.data() + index * batchBlockSize;
+  };
+
+  for (size_t begin = 0; begin < pointsCount; begin += batchBlockSize) {
+    const size_t size = std::min(batchBlockSize, pointsCount - begin);
+    uint8_t *undefinedMask = res.undefinedMask.data() + begin;
+    size_t stackSize = 0;
+
+    for (const auto &[operation, argument] : instructions) {
+      switch (operation) {
+        case Operation::Constant: {
+          std::fill_n(getSlot(stackSize++), size, constantDoubleValues[argument]);
+          break;
+        }
+        case Operation::Variable: {
+          std::copy_n(columns[argument].data() + begin, size, getSlot(stackSize++));
+          break;
+        }
+        case Operation::Add:
+        case Operation::Mul: {
+          double *first = getSlot(stackSize - argument);
+
+          for (size_t i = stackSize - argument + 1; i < stackSize; i++) {
+            if (operation == Operation::Add) {
+              applyBinary(first, getSlot(i), size, std::plus<>{});
+            }
+            else {
+              applyBinary(first, getSlot(i), size, std::multiplies<>{});
+            }
+          }
+
+          stackSize = stackSize - argument + 1;
+          break;
+        }
+        default: {
+          if (argument == 1) {
+            evaluateUnaryBatch(operation, getSlot(stackSize - 1), size);
+          }
+          else {
+            evaluateBinaryBatch(operation, getSlot(stackSize - 2), getSlot(stackSize - 1), size);
+            stackSize--;
+          }
+
+          break;
+        }
+      }
+
+      // Checked after every instruction, as infinities may turn into finite values later
+      updateUndefinedMask(getSlot(stackSize - 1), undefinedMask, size);
+    }
+
+    const double *values = getSlot(0);
+
+    for (size_t i = 0; i < size; i++) {
+      res.values[begin + i] = undefinedMask[i] != 0 ? undefinedValue : values[i];
+    }
+  }
+
+  return res;
+}
+
+void CompiledExpression::compile(const ArgumentPtr &arg, size_t &stackSize) {
+  if (const auto var = cast<Variable>(arg)) {
+    const auto iter = std::ranges::find(variables, *var);
+
+    if (iter == variables.end()) {
+      throw InvalidInputException(fmt::format(
+          R"(Unable to compile "{}" (variable {} is not bound))",
+          exprString,
+          var->toString()));
+    }
+
+    addInstruction(Operation::Variable, static_cast<size_t>(iter - variables.begin()), stackSize);
+    return;
+  }
+
+  if (isConstant(arg)) {
+    addInstruction(Operation::Constant, constants.size(), stackSize);
+    constants.emplace_back(arg);
+    return;
+  }
+
+  if (const auto expr = cast<IExpression>(arg)) {
+    const ArgumentPtrVector &children = expr->getChildren();
+
+    if (const auto operation = findOperation(expr->getFunction());
+        operation && isArgumentsSizeValid(*operation, children.size())) {
+
+      for (const auto &child : children) {
+        compile(child, stackSize);
+      }
+
+      addInstruction(*operation, children.size(), stackSize);
+      return;
+    }
+  }
+
+  throw InvalidInputException(fmt::format(
+      R"(Unable to compile "{}" ({} is not supported))",
+      exprString,
+      arg->toString()));
+}
+
+void CompiledExpression::addInstruction(const Operation operation, const size_t argument, size_t &stackSize) {
+  instructions.emplace_back(operation, argument);
+
+  if (operation == Operation::Constant || operation == Operation::Variable) {
+    stackSize++;
+  }
+  else {
+    stackSize = stackSize - argument + 1;
+  }
+
+  maxStackSize = std::max(maxStackSize, stackSize);
+}
+
+}
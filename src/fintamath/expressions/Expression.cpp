@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ranges>
 #include <stack>
@@ -20,9 +21,11 @@
 #include "fintamath/core/MathObjectUtils.hpp"
 #include "fintamath/core/Tokenizer.hpp"
 #include "fintamath/exceptions/InvalidInputException.hpp"
+#include "fintamath/expressions/CompiledExpression.hpp"
 #include "fintamath/expressions/ExpressionUtils.hpp"
 #include "fintamath/expressions/FunctionExpression.hpp"
 #include "fintamath/expressions/IExpression.hpp"
+#include "fintamath/expressions/interfaces/IPolynomExpression.hpp"
 #include "fintamath/functions/FunctionArguments.hpp"
 #include "fintamath/functions/FunctionUtils.hpp"
 #include "fintamath/functions/IFunction.hpp"
@@ -37,7 +40,9 @@
 #include "fintamath/functions/other/Factorial.hpp"
 #include "fintamath/literals/Variable.hpp"
 #include "fintamath/literals/constants/IConstant.hpp"
+#include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/IntegerFunctions.hpp"
+#include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
 
 namespace fintamath {
@@ -61,6 +66,44 @@ Expression::Expression(const IMathObject &obj) : Expression(obj.clone()) {
 Expression::Expression(const int64_t val) : child(Integer(val).clone()) {
 }
 
+Expression::Expression(const Expression &rhs) : IExpressionCRTP(rhs) {
+  const std::scoped_lock lock(rhs.mutex);
+  child = rhs.child;
+  childrenCached = rhs.childrenCached;
+  stringCached = rhs.stringCached;
+  isSimplified = rhs.isSimplified.load();
+}
+
+Expression::Expression(Expression &&rhs) noexcept
+    : IExpressionCRTP(std::move(rhs)),
+      child(std::move(rhs.child)),
+      childrenCached(std::move(rhs.childrenCached)),
+      stringCached(std::move(rhs.stringCached)),
+      isSimplified(rhs.isSimplified.load()) {
+}
+
+Expression &Expression::operator=(const Expression &rhs) {
+  if (this != &rhs) {
+    const std::scoped_lock lock(mutex, rhs.mutex);
+    IExpressionCRTP::operator=(rhs);
+    child = rhs.child;
+    childrenCached = rhs.childrenCached;
+    stringCached = rhs.stringCached;
+    isSimplified = rhs.isSimplified.load();
+  }
+
+  return *this;
+}
+
+Expression &Expression::operator=(Expression &&rhs) noexcept {
+  IExpressionCRTP::operator=(std::move(rhs));
+  child = std::move(rhs.child);
+  childrenCached = std::move(rhs.childrenCached);
+  stringCached = std::move(rhs.stringCached);
+  isSimplified = rhs.isSimplified.load();
+  return *this;
+}
+
 std::string Expression::toString() const {
   simplifyMutable();
   return stringCached;
@@ -77,11 +120,85 @@ Expression approximate(const Expression &rhs, const unsigned precision) {
   Expression approxExpr = rhs;
   Expression::approximateChild(approxExpr.child);
   Expression::setPrecisionChild(approxExpr.child, precision, cache[precision]);
-  approxExpr.updateStringMutable();
+  approxExpr.updateCachedMutable();
 
   return approxExpr;
 }
 
+namespace {
+
+std::optional<Real> evaluateCertified(const ArgumentPtr &arg, const unsigned precision) {
+  try {
+    return CompiledExpression(Expression(arg), {}).evaluateCertified({}, precision);
+  }
+  catch (const InvalidInputException &) {
+    // Functions without numeric evaluation, their arguments still can be evaluated
+    return {};
+  }
+}
+
+// Replaces the largest subexpressions without variables by their values certified to the given precision
+void approximateCertifiedChild(ArgumentPtr &child, const unsigned precision) {
+  const auto exprChild = cast<IExpression>(child);
+
+  if (!exprChild) {
+    return;
+  }
+
+  if (!containsVariable(child)) {
+    if (auto res = evaluateCertified(child, precision)) {
+      child = std::move(*res).clone();
+      return;
+    }
+  }
+
+  ArgumentPtrVector children = exprChild->getChildren();
+  bool isChanged = false;
+
+  // Terms without variables are evaluated together, as they may cancel each other out
+  if (is<IPolynomExpression>(exprChild)) {
+    ArgumentPtrVector constChildren;
+    ArgumentPtrVector varChildren;
+
+    for (const auto &grandChild : children) {
+      (containsVariable(grandChild) ? varChildren : constChildren).emplace_back(grandChild);
+    }
+
+    if (constChildren.size() > 1 && !varChildren.empty()) {
+      auto constExpr = cast<IExpression>(exprChild->clone());
+      constExpr->setChildren(constChildren);
+
+      if (auto res = evaluateCertified(std::move(constExpr), precision)) {
+        children = std::move(varChildren);
+        children.emplace_back(std::move(*res).clone());
+        isChanged = true;
+      }
+    }
+  }
+
+  for (auto &grandChild : children) {
+    const ArgumentPtr prevGrandChild = grandChild;
+    approximateCertifiedChild(grandChild, precision);
+    isChanged = isChanged || grandChild != prevGrandChild;
+  }
+
+  if (isChanged) {
+    auto newExprChild = cast<IExpression>(exprChild->clone());
+    newExprChild->setChildren(children);
+    child = std::move(newExprChild);
+  }
+}
+
+}
+
+Expression approximateAdaptive(const Expression &rhs, const unsigned precision) {
+  ArgumentPtr approxChild = rhs.getChildren().front();
+  approximateCertifiedChild(approxChild, precision);
+
+  // Subexpressions that are not certified are approximated as usual
+  return approximate(Expression(approxChild), precision);
+}
+
 const std::shared_ptr<IFunction> &Expression::getFunction() const {
   static const std::shared_ptr<IFunction> func;
   return func;
@@ -89,7 +206,6 @@ const std::shared_ptr<IFunction> &Expression::getFunction() const {
 
 const ArgumentPtrVector &Expression::getChildren() const {
   simplifyMutable();
-  childrenCached.front() = child;
   return childrenCached;
 }
 
@@ -118,8 +234,18 @@ ArgumentPtr Expression::simplify() const {
   return child;
 }
 
+bool Expression::isInternable() const {
+  return false;
+}
+
 void Expression::simplifyMutable() const {
-  if (isSimplified) {
+  if (isSimplified.load(std::memory_order_acquire)) {
+    return;
+  }
+
+  const std::scoped_lock lock(mutex);
+
+  if (isSimplified.load(std::memory_order_relaxed)) {
     return;
   }
 
@@ -131,11 +257,12 @@ void Expression::simplifyMutable() const {
     simplifyChild(child);
   }
 
-  isSimplified = true;
-  updateStringMutable();
+  updateCachedMutable();
+  isSimplified.store(true, std::memory_order_release);
 }
 
-void Expression::updateStringMutable() const {
+void Expression::updateCachedMutable() const {
+  childrenCached.front() = child;
   stringCached = child->toString();
 }
 
@@ -290,15 +417,72 @@ Term Expression::parseTerm(const std::string &str) {
     return parser;
   }();
 
+  // Names are parsed once per registration version, then their values are cloned
+  static Cache<std::pair<size_t, std::string>, std::shared_ptr<const IMathObject>> nameToValueCache([](const std::pair<size_t, std::string> &versionAndName) {
+    std::shared_ptr<const IMathObject> value;
+
+    if (auto termValue = termValueParser.parseFirst(versionAndName.second)) {
+      value = std::move(*termValue);
+    }
+
+    return value;
+  });
+
   Term term = {str, {}};
 
-  if (auto termValue = termValueParser.parseFirst(str)) {
+  if (auto numberValue = parseNumberTerm(str)) {
+    term.value = std::move(numberValue);
+  }
+  else if (isNameTerm(str)) {
+    if (const auto &value = nameToValueCache[{Tokenizer::getRegistrationVersion(), str}]) {
+      term.value = value->clone();
+    }
+  }
+  else if (auto termValue = termValueParser.parseFirst(str)) {
     term.value = std::move(*termValue);
   }
 
   return term;
 }
 
+std::unique_ptr<IMathObject> Expression::parseNumberTerm(const std::string &str) {
+  size_t digitsCount = 0;
+  size_t pointsCount = 0;
+
+  for (const char ch : str) {
+    if (ch >= '0' && ch <= '9') {
+      digitsCount++;
+    }
+    else if (ch == '.') {
+      pointsCount++;
+    }
+    else {
+      return {};
+    }
+  }
+
+  if (digitsCount == 0) {
+    return {};
+  }
+
+  // The same types the number parser would construct first, without trying the others
+  if (pointsCount == 0) {
+    return std::make_unique<Integer>(str);
+  }
+
+  if (pointsCount == 1) {
+    return std::make_unique<Rational>(str);
+  }
+
+  return {};
+}
+
+bool Expression::isNameTerm(const std::string &str) {
+  return std::ranges::none_of(str, [](const char ch) {
+    return ch == '.' || (ch >= '0' && ch <= '9');
+  });
+}
+
 void Expression::moveFunctionTermsToObjects(ObjectStack &objects, std::stack<FunctionTerm> &functions, const IOperator *nextOper) {
   if (isPrefixOperator(nextOper)) {
     return;
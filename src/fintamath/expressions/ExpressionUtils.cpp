@@ -36,6 +36,48 @@ namespace fintamath::detail {
 
 const ArgumentPtr one = Integer(1).clone();
 
+bool isIdentical(const IMathObject &lhs, const IMathObject &rhs) {
+  if (&lhs == &rhs) {
+    return true;
+  }
+
+  if (lhs.getClass() != rhs.getClass()) {
+    return false;
+  }
+
+  if (const auto *lhsExpr = cast<IExpression>(&lhs)) {
+    const auto &rhsExpr = cast<IExpression>(rhs);
+
+    if (!lhsExpr->isInternable() || !rhsExpr.isInternable()) {
+      return false;
+    }
+
+    if (lhsExpr->getHash() != rhsExpr.getHash()) {
+      return false;
+    }
+
+    const auto &lhsFunc = lhsExpr->getFunction();
+    const auto &rhsFunc = rhsExpr.getFunction();
+
+    if (static_cast<bool>(lhsFunc) != static_cast<bool>(rhsFunc) || (lhsFunc && *lhsFunc != *rhsFunc)) {
+      return false;
+    }
+
+    const ArgumentPtrVector &lhsChildren = lhsExpr->getChildren();
+    const ArgumentPtrVector &rhsChildren = rhsExpr.getChildren();
+
+    return std::ranges::equal(lhsChildren, rhsChildren, [](const ArgumentPtr &lhsChild, const ArgumentPtr &rhsChild) {
+      return isIdentical(*lhsChild, *rhsChild);
+    });
+  }
+
+  if (const auto *lhsNum = cast<INumber>(&lhs); lhsNum && lhsNum->getPrecision()) {
+    return false;
+  }
+
+  return lhs == rhs;
+}
+
 bool isInfinity(const ArgumentPtr &arg) {
   return is<Inf>(arg) || is<NegInf>(arg) || is<ComplexInf>(arg);
 }
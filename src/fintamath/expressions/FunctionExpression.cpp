@@ -20,6 +20,7 @@ FunctionExpression::FunctionExpression(const IFunction &inFunc, ArgumentPtrVecto
     : func(cast<IFunction>(inFunc.clone())) {
 
   for (auto &&child : std::move(inChildren)) {
+    internChild(child);
     children.emplace_back(std::move(child));
   }
 }
@@ -82,6 +83,12 @@ void FunctionExpression::setChildren(const ArgumentPtrVector &childVect) {
   (void)makeExprWithValidation(*func, childVect);
 
   children = childVect;
+
+  for (auto &child : children) {
+    internChild(child);
+  }
+
+  resetHash();
 }
 
 }
@@ -4,15 +4,19 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "fintamath/core/Converter.hpp"
+#include "fintamath/core/Hash.hpp"
 #include "fintamath/core/IMathObject.hpp"
 #include "fintamath/core/MathObjectUtils.hpp"
 #include "fintamath/core/MultiMethod.hpp"
+#include "fintamath/core/NodePool.hpp"
 #include "fintamath/expressions/ExpressionComparator.hpp"
 #include "fintamath/expressions/ExpressionUtils.hpp"
+#include "fintamath/expressions/SimplifyCache.hpp"
 #include "fintamath/functions/FunctionArguments.hpp"
 #include "fintamath/functions/IFunction.hpp"
 #include "fintamath/literals/Variable.hpp"
@@ -29,6 +33,35 @@ FINTAMATH_PARENT_CLASS_IMPLEMENTATION(IExpression)
 
 using namespace detail;
 
+namespace {
+
+size_t hashChild(const IMathObject &child) {
+  if (const auto *childExpr = cast<IExpression>(&child)) {
+    return childExpr->getHash();
+  }
+
+  // Equal integers and rationals share a hash, so terms which differ only in numbers do not collide
+  if (const auto *childInt = cast<Integer>(&child)) {
+    return Hash<Rational>{}(Rational(*childInt));
+  }
+
+  if (const auto *childRat = cast<Rational>(&child)) {
+    return Hash<Rational>{}(*childRat);
+  }
+
+  // Numbers of different types are equal if their values are equal, so they share one hash
+  if (is<INumber>(child)) {
+    return Hash<MathObjectClass>{}(INumber::getClassStatic());
+  }
+
+  size_t seed = 0;
+  hashCombine(seed, child.getClass());
+  hashCombine(seed, child.toString());
+  return seed;
+}
+
+}
+
 IExpression::VariableSet IExpression::getVariables() const {
   VariableSet vars;
 
@@ -85,6 +118,40 @@ const std::shared_ptr<IFunction> &IExpression::getOutputFunction() const {
   return getFunction();
 }
 
+size_t IExpression::getHash() const {
+  if (const auto hash = hashCached.get()) {
+    return *hash;
+  }
+
+  size_t seed = 0;
+
+  if (const auto &func = getFunction()) {
+    hashCombine(seed, func->getClass());
+  }
+
+  for (const auto &child : getChildren()) {
+    hashCombine(seed, hashChild(*child));
+  }
+
+  return hashCached.set(seed);
+}
+
+void IExpression::resetHash() const noexcept {
+  hashCached.reset();
+}
+
+bool IExpression::isInternable() const {
+  return true;
+}
+
+void *IExpression::operator new(const size_t size) {
+  return NodePool::allocate(size);
+}
+
+void IExpression::operator delete(void *ptr, const size_t size) noexcept {
+  NodePool::deallocate(ptr, size);
+}
+
 ArgumentPtr IExpression::simplify() const {
   ArgumentPtr simpl = cast<IExpression>(clone());
   preSimplifyChild(simpl);
@@ -94,7 +161,7 @@ ArgumentPtr IExpression::simplify() const {
 
 void IExpression::simplifyChild(ArgumentPtr &child) {
   if (const auto exprChild = cast<IExpression>(child)) {
-    if (const auto simplObj = exprChild->simplify()) {
+    if (const auto simplObj = simplifyCached(exprChild, SimplifyCache::Phase::Simplify)) {
       child = simplObj;
     }
   }
@@ -102,7 +169,7 @@ void IExpression::simplifyChild(ArgumentPtr &child) {
 
 void IExpression::preSimplifyChild(ArgumentPtr &child) {
   if (const auto exprChild = cast<IExpression>(child)) {
-    if (const auto simplObj = exprChild->preSimplify()) {
+    if (const auto simplObj = simplifyCached(exprChild, SimplifyCache::Phase::PreSimplify)) {
       child = simplObj;
     }
   }
@@ -124,7 +191,7 @@ void IExpression::preSimplifyChild(ArgumentPtr &child) {
 
 void IExpression::postSimplifyChild(ArgumentPtr &child) {
   if (const auto exprChild = cast<IExpression>(child)) {
-    if (const auto simplObj = exprChild->postSimplify()) {
+    if (const auto simplObj = simplifyCached(exprChild, SimplifyCache::Phase::PostSimplify)) {
       child = simplObj;
     }
   }
@@ -150,6 +217,71 @@ void IExpression::setPrecisionChild(ArgumentPtr &child, const unsigned precision
   }
 }
 
+void IExpression::internChild(ArgumentPtr &child) {
+  const auto *exprChild = cast<IExpression>(child.get());
+
+  if (!exprChild || !exprChild->isInternable()) {
+    return;
+  }
+
+  static constexpr size_t minPruneSize = 1024;
+
+  // Only weak references are stored, so the table never extends lifetime of the nodes
+  thread_local std::unordered_multimap<size_t, std::weak_ptr<const IMathObject>> internedChildren;
+  thread_local size_t pruneSize = minPruneSize;
+
+  const size_t hash = exprChild->getHash();
+  auto [iter, end] = internedChildren.equal_range(hash);
+
+  while (iter != end) {
+    if (ArgumentPtr internedChild = iter->second.lock()) {
+      if (isIdentical(*internedChild, *child)) {
+        child = std::move(internedChild);
+        return;
+      }
+
+      ++iter;
+    }
+    else {
+      iter = internedChildren.erase(iter);
+    }
+  }
+
+  internedChildren.emplace(hash, child);
+
+  if (internedChildren.size() >= pruneSize) {
+    std::erase_if(internedChildren, [](const auto &entry) {
+      return entry.second.expired();
+    });
+
+    pruneSize = std::max(minPruneSize, internedChildren.size() * 2);
+  }
+}
+
+ArgumentPtr IExpression::simplifyCached(const std::shared_ptr<const IExpression> &expr, const SimplifyCache::Phase phase) {
+  if (ArgumentPtr res = SimplifyCache::find(expr, phase)) {
+    return res;
+  }
+
+  ArgumentPtr res;
+
+  switch (phase) {
+    case SimplifyCache::Phase::Simplify:
+      res = expr->simplify();
+      break;
+    case SimplifyCache::Phase::PreSimplify:
+      res = expr->preSimplify();
+      break;
+    case SimplifyCache::Phase::PostSimplify:
+      res = expr->postSimplify();
+      break;
+  }
+
+  SimplifyCache::add(expr, phase, res);
+
+  return res;
+}
+
 std::unique_ptr<INumber> IExpression::convertToApproximated(const INumber &num) {
   static const auto multiApproximate = [] {
     static MultiMethod<std::unique_ptr<IMathObject>(const INumber &)> outMultiApproximate;
@@ -0,0 +1,171 @@
+#include "fintamath/expressions/SimplifyCache.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "fintamath/core/Hash.hpp"
+#include "fintamath/expressions/ExpressionUtils.hpp"
+#include "fintamath/expressions/IExpression.hpp"
+#include "fintamath/functions/FunctionArguments.hpp"
+#include "fintamath/numbers/Real.hpp"
+
+namespace fintamath {
+
+using namespace detail;
+
+namespace {
+
+struct Entry {
+  size_t key = 0;
+
+  SimplifyCache::Phase phase = SimplifyCache::Phase::Simplify;
+
+  unsigned precision = 0;
+
+  std::shared_ptr<const IExpression> expr;
+
+  ArgumentPtr res;
+};
+
+using EntryList = std::list<Entry>;
+
+struct State {
+  std::mutex mutex;
+
+  // Most recently used entries first
+  EntryList entries;
+
+  std::unordered_multimap<size_t, EntryList::iterator> keyToEntryMap;
+
+  std::atomic<size_t> capacity = 0;
+
+  size_t hits = 0;
+
+  size_t misses = 0;
+};
+
+State &getState() {
+  static State state;
+  return state;
+}
+
+size_t makeKey(const IExpression &expr, const SimplifyCache::Phase phase, const unsigned precision) {
+  size_t seed = expr.getHash();
+  hashCombine(seed, static_cast<int>(phase));
+  hashCombine(seed, precision);
+  return seed;
+}
+
+void eraseEntry(State &state, const EntryList::iterator &entryIter) {
+  auto [iter, end] = state.keyToEntryMap.equal_range(entryIter->key);
+
+  for (; iter != end; ++iter) {
+    if (iter->second == entryIter) {
+      state.keyToEntryMap.erase(iter);
+      break;
+    }
+  }
+
+  state.entries.erase(entryIter);
+}
+
+void shrinkToCapacity(State &state) {
+  while (state.entries.size() > state.capacity) {
+    eraseEntry(state, std::prev(state.entries.end()));
+  }
+}
+
+}
+
+void SimplifyCache::setCapacity(const size_t capacity) {
+  State &state = getState();
+  const std::scoped_lock lock(state.mutex);
+
+  state.capacity = capacity;
+  shrinkToCapacity(state);
+}
+
+size_t SimplifyCache::getCapacity() noexcept {
+  return getState().capacity;
+}
+
+void SimplifyCache::clear() {
+  State &state = getState();
+  const std::scoped_lock lock(state.mutex);
+
+  state.entries.clear();
+  state.keyToEntryMap.clear();
+  state.hits = 0;
+  state.misses = 0;
+}
+
+SimplifyCache::Statistics SimplifyCache::getStatistics() {
+  State &state = getState();
+  const std::scoped_lock lock(state.mutex);
+
+  return {
+      .hits = state.hits,
+      .misses = state.misses,
+      .size = state.entries.size(),
+      .capacity = state.capacity,
+  };
+}
+
+ArgumentPtr SimplifyCache::find(const std::shared_ptr<const IExpression> &expr, const Phase phase) {
+  State &state = getState();
+
+  if (state.capacity == 0 || !expr->isInternable()) {
+    return {};
+  }
+
+  const unsigned precision = Real::getPrecisionStatic();
+  const size_t key = makeKey(*expr, phase, precision);
+
+  const std::scoped_lock lock(state.mutex);
+
+  auto [iter, end] = state.keyToEntryMap.equal_range(key);
+
+  for (; iter != end; ++iter) {
+    const EntryList::iterator entryIter = iter->second;
+
+    if (entryIter->phase == phase && entryIter->precision == precision && isIdentical(*entryIter->expr, *expr)) {
+      state.entries.splice(state.entries.begin(), state.entries, entryIter);
+      state.hits++;
+      return entryIter->res;
+    }
+  }
+
+  state.misses++;
+  return {};
+}
+
+void SimplifyCache::add(const std::shared_ptr<const IExpression> &expr, const Phase phase, const ArgumentPtr &res) {
+  State &state = getState();
+
+  if (state.capacity == 0 || !expr->isInternable() || !res) {
+    return;
+  }
+
+  const unsigned precision = Real::getPrecisionStatic();
+  const size_t key = makeKey(*expr, phase, precision);
+
+  const std::scoped_lock lock(state.mutex);
+
+  state.entries.emplace_front(Entry{
+      .key = key,
+      .phase = phase,
+      .precision = precision,
+      .expr = expr,
+      .res = res,
+  });
+  state.keyToEntryMap.emplace(key, state.entries.begin());
+
+  shrinkToCapacity(state);
+}
+
+}
@@ -109,6 +109,10 @@ void CompExpr::markAsSolution() {
   isSolution = true;
 }
 
+bool CompExpr::isInternable() const {
+  return !isSolution;
+}
+
 std::shared_ptr<IFunction> CompExpr::getOppositeFunction(const IFunction &function) {
   static const std::unordered_map<std::string, std::shared_ptr<IFunction>> nameToOppositeFuncMap = {
       {Eqv{}.toString(), std::make_shared<Eqv>()},
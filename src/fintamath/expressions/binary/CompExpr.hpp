@@ -22,6 +22,8 @@ public:
 
   void markAsSolution();
 
+  bool isInternable() const override;
+
 protected:
   ArgumentPtr preSimplify() const override;
 
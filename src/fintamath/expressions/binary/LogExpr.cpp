@@ -50,10 +50,13 @@ const std::shared_ptr<IFunction> &LogExpr::getOutputFunction() const {
 
 ArgumentPtr LogExpr::approximate() const {
   if (*lhsChild == E{}) {
+    ArgumentPtr approxRhsChild = rhsChild;
+    approximateChild(approxRhsChild);
+
     const auto approxExpr = cast<LogExpr>(clone());
-    approximateChild(approxExpr->rhsChild);
+    approxExpr->setChildren({lhsChild, approxRhsChild});
 
-    if (is<INumber>(approxExpr->rhsChild)) {
+    if (is<INumber>(approxRhsChild)) {
       if (const auto res = cast<INumber>(approxExpr->IBinaryExpression::approximate())) {
         return res;
       }
@@ -67,8 +70,11 @@ ArgumentPtr LogExpr::approximate() const {
 
 ArgumentPtr LogExpr::setPrecision(const unsigned precision, const Integer &maxInt) const {
   if (*lhsChild == E{}) {
+    ArgumentPtr approxRhsChild = rhsChild;
+    setPrecisionChild(approxRhsChild, precision, maxInt);
+
     const auto approxExpr = cast<LogExpr>(clone());
-    setPrecisionChild(approxExpr->rhsChild, precision, maxInt);
+    approxExpr->setChildren({lhsChild, approxRhsChild});
     return approxExpr->simplify();
   }
 
@@ -12,6 +12,7 @@
 #include "fintamath/expressions/ExpressionUtils.hpp"
 #include "fintamath/expressions/IExpression.hpp"
 #include "fintamath/expressions/interfaces/IBinaryExpression.hpp"
+#include "fintamath/expressions/polynomial/SparsePolynom.hpp"
 #include "fintamath/functions/FunctionArguments.hpp"
 #include "fintamath/functions/IFunction.hpp"
 #include "fintamath/functions/arithmetic/Abs.hpp"
@@ -91,10 +92,13 @@ std::string PowExpr::toString() const {
 
 ArgumentPtr PowExpr::approximate() const {
   if (const auto ratRhsChild = cast<Rational>(rhsChild); ratRhsChild && ratRhsChild->denominator() <= maxPreciseRoot) {
+    ArgumentPtr approxLhsChild = lhsChild;
+    approximateChild(approxLhsChild);
+
     auto approxExpr = cast<PowExpr>(clone());
-    approximateChild(approxExpr->lhsChild);
+    approxExpr->setChildren({approxLhsChild, rhsChild});
 
-    if (is<INumber>(approxExpr->lhsChild)) {
+    if (is<INumber>(approxLhsChild)) {
       return approxExpr->IBinaryExpression::approximate();
     }
 
@@ -106,8 +110,11 @@ ArgumentPtr PowExpr::approximate() const {
 
 ArgumentPtr PowExpr::setPrecision(const unsigned precision, const Integer &maxInt) const {
   if (const auto ratRhsChild = cast<Rational>(rhsChild); ratRhsChild && ratRhsChild->denominator() <= maxPreciseRoot) {
+    ArgumentPtr approxLhsChild = lhsChild;
+    setPrecisionChild(approxLhsChild, precision, maxInt);
+
     auto approxExpr = cast<PowExpr>(clone());
-    setPrecisionChild(approxExpr->lhsChild, precision, maxInt);
+    approxExpr->setChildren({approxLhsChild, rhsChild});
     return approxExpr;
   }
 
@@ -180,6 +187,10 @@ ArgumentPtr PowExpr::sumPolynomSimplify(const ArgumentPtr &expr, const Integer &
     return {};
   }
 
+  if (ArgumentPtr res = powPolynom(expr, power)) {
+    return res;
+  }
+
   const size_t variableCount = polynom.size();
   Integer bitNumber = generateFirstNum(power);
   const Integer combins = combinations(power + variableCount - 1, power);
@@ -20,6 +20,11 @@ IBinaryExpression::IBinaryExpression(const IFunction &inFunc, ArgumentPtr lhs, A
     : func(cast<IFunction>(inFunc.clone())),
       lhsChild(std::move(lhs)),
       rhsChild(std::move(rhs)) {
+
+  internChild(lhsChild);
+  internChild(rhsChild);
+
+  childrenCached = {lhsChild, rhsChild};
 }
 
 std::string IBinaryExpression::toString() const {
@@ -38,8 +43,6 @@ const std::shared_ptr<IFunction> &IBinaryExpression::getFunction() const {
 }
 
 const ArgumentPtrVector &IBinaryExpression::getChildren() const {
-  childrenCached.front() = lhsChild;
-  childrenCached.back() = rhsChild;
   return childrenCached;
 }
 
@@ -47,6 +50,7 @@ ArgumentPtr IBinaryExpression::preSimplify() const {
   const auto simpl = cast<IBinaryExpression>(clone());
   preSimplifyChild(simpl->lhsChild);
   preSimplifyChild(simpl->rhsChild);
+  simpl->childrenCached = {simpl->lhsChild, simpl->rhsChild};
   return simpl->simplifyRec(false);
 }
 
@@ -54,6 +58,7 @@ ArgumentPtr IBinaryExpression::postSimplify() const {
   const auto simpl = cast<IBinaryExpression>(clone());
   postSimplifyChild(simpl->lhsChild);
   postSimplifyChild(simpl->rhsChild);
+  simpl->childrenCached = {simpl->lhsChild, simpl->rhsChild};
   return simpl->simplifyRec(true);
 }
 
@@ -102,6 +107,11 @@ void IBinaryExpression::setChildren(const ArgumentPtrVector &childVect) {
 
   lhsChild = childVect[0];
   rhsChild = childVect[1];
+
+  internChild(lhsChild);
+  internChild(rhsChild);
+  childrenCached = {lhsChild, rhsChild};
+  resetHash();
 }
 
 }
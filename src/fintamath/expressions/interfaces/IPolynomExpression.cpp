@@ -29,6 +29,10 @@ using namespace detail;
 IPolynomExpression::IPolynomExpression(const IFunction &inFunc, ArgumentPtrVector args)
     : func(cast<IFunction>(inFunc.clone())),
       children(std::move(args)) {
+
+  for (auto &child : children) {
+    internChild(child);
+  }
 }
 
 const std::shared_ptr<IFunction> &IPolynomExpression::getFunction() const {
@@ -43,6 +47,12 @@ void IPolynomExpression::setChildren(const ArgumentPtrVector &childVect) {
   (void)makeExprWithValidation(*func, childVect);
 
   children = childVect;
+
+  for (auto &child : children) {
+    internChild(child);
+  }
+
+  resetHash();
 }
 
 std::string IPolynomExpression::toString() const {
@@ -117,6 +127,7 @@ ArgumentPtr IPolynomExpression::postSimplify() const {
 
 void IPolynomExpression::simplifyRec(const bool isPostSimplify) {
   compress();
+  simplifyNumbers();
   sort();
 
   bool isExprSimplified = true;
@@ -224,6 +235,9 @@ std::strong_ordering IPolynomExpression::compare(const ArgumentPtr &lhs, const A
   return fintamath::compare(lhs, rhs, options);
 }
 
+void IPolynomExpression::simplifyNumbers() {
+}
+
 void IPolynomExpression::sort() {
   std::ranges::stable_sort(children, [this](const ArgumentPtr &lhs, const ArgumentPtr &rhs) {
     return compare(lhs, rhs) == std::strong_ordering::greater;
@@ -19,6 +19,10 @@ using namespace detail;
 IUnaryExpression::IUnaryExpression(const IFunction &inFunc, ArgumentPtr rhs)
     : func(cast<IFunction>(inFunc.clone())),
       child(std::move(rhs)) {
+
+  internChild(child);
+
+  childrenCached = {child};
 }
 
 std::string IUnaryExpression::toString() const {
@@ -41,7 +45,6 @@ const std::shared_ptr<IFunction> &IUnaryExpression::getFunction() const {
 }
 
 const ArgumentPtrVector &IUnaryExpression::getChildren() const {
-  childrenCached.front() = child;
   return childrenCached;
 }
 
@@ -56,12 +59,14 @@ IUnaryExpression::SimplifyFunctionVector IUnaryExpression::getFunctionsForPostSi
 ArgumentPtr IUnaryExpression::preSimplify() const {
   const auto simpl = cast<IUnaryExpression>(clone());
   preSimplifyChild(simpl->child);
+  simpl->childrenCached = {simpl->child};
   return simpl->simplifyRec(false);
 }
 
 ArgumentPtr IUnaryExpression::postSimplify() const {
   const auto simpl = cast<IUnaryExpression>(clone());
   postSimplifyChild(simpl->child);
+  simpl->childrenCached = {simpl->child};
   return simpl->simplifyRec(true);
 }
 
@@ -99,6 +104,10 @@ void IUnaryExpression::setChildren(const ArgumentPtrVector &childVect) {
   (void)makeExprWithValidation(*func, childVect);
 
   child = childVect.front();
+
+  internChild(child);
+  childrenCached = {child};
+  resetHash();
 }
 
 }
\ No newline at end of file
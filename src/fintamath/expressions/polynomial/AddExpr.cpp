@@ -1,5 +1,6 @@
 #include "fintamath/expressions/polynomial/AddExpr.hpp"
 
+#include <algorithm>
 #include <compare>
 #include <cstddef>
 #include <memory>
@@ -30,6 +31,7 @@
 #include "fintamath/literals/constants/Inf.hpp"
 #include "fintamath/literals/constants/NegInf.hpp"
 #include "fintamath/literals/constants/Undefined.hpp"
+#include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
 
 namespace fintamath {
@@ -99,6 +101,31 @@ std::strong_ordering AddExpr::compare(const ArgumentPtr &lhs, const ArgumentPtr
   return IPolynomExpression::compare(lhs, rhs);
 }
 
+void AddExpr::simplifyNumbers() {
+  const auto isRational = [](const ArgumentPtr &child) {
+    return is<Integer>(child) || is<Rational>(child);
+  };
+
+  if (std::ranges::count_if(children, isRational) < 2) {
+    return;
+  }
+
+  // Intermediate sums are not reduced, the gcd is computed once for the result
+  RationalAccumulator sum;
+
+  for (const auto &child : children) {
+    if (const auto childInt = cast<Integer>(child)) {
+      sum += *childInt;
+    }
+    else if (const auto childRat = cast<Rational>(child)) {
+      sum += *childRat;
+    }
+  }
+
+  std::erase_if(children, isRational);
+  children.emplace_back(sum.toRational().toMinimalObject());
+}
+
 AddExpr::SimplifyFunctionVector AddExpr::getFunctionsForPreSimplify() const {
   static const SimplifyFunctionVector simplifyFunctions = {
       &AddExpr::divSimplify,
@@ -31,6 +31,8 @@ protected:
 
   std::strong_ordering compare(const ArgumentPtr &lhs, const ArgumentPtr &rhs) const override;
 
+  void simplifyNumbers() override;
+
 private:
   static ArgumentPtr constSimplify(const IFunction &func, const ArgumentPtr &lhs, const ArgumentPtr &rhs);
 
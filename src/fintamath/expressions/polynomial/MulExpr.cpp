@@ -8,6 +8,7 @@
 #include "fintamath/expressions/ExpressionUtils.hpp"
 #include "fintamath/expressions/IExpression.hpp"
 #include "fintamath/expressions/interfaces/IPolynomExpression.hpp"
+#include "fintamath/expressions/polynomial/SparsePolynom.hpp"
 #include "fintamath/functions/FunctionArguments.hpp"
 #include "fintamath/functions/IFunction.hpp"
 #include "fintamath/functions/IOperator.hpp"
@@ -264,6 +265,10 @@ ArgumentPtr MulExpr::polynomSimplify(const IFunction & /*func*/, const ArgumentP
     return {};
   }
 
+  if (ArgumentPtr res = mulPolynoms(lhs, rhs)) {
+    return res;
+  }
+
   ArgumentPtrVector resultVect;
 
   for (const auto &lhsSubChild : lhsChildren) {
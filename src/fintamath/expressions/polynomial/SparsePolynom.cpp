@@ -0,0 +1,395 @@
+#include "fintamath/expressions/polynomial/SparsePolynom.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "fintamath/core/MathObjectUtils.hpp"
+#include "fintamath/expressions/ExpressionUtils.hpp"
+#include "fintamath/expressions/IExpression.hpp"
+#include "fintamath/functions/FunctionArguments.hpp"
+#include "fintamath/functions/arithmetic/Add.hpp"
+#include "fintamath/functions/arithmetic/Mul.hpp"
+#include "fintamath/functions/powers/Pow.hpp"
+#include "fintamath/literals/constants/Undefined.hpp"
+#include "fintamath/numbers/Integer.hpp"
+#include "fintamath/numbers/Rational.hpp"
+
+namespace fintamath::detail {
+
+namespace {
+
+// Dense multiplication is used while the range of result monomials is small enough to be allocated
+constexpr SparsePolynom::Monom denseRangeLimit = 1U << 16U;
+
+// Dense multiplication is used while most of the allocated coefficients are expected to be touched
+constexpr size_t denseRangeFactor = 8;
+
+using Exponents = std::vector<uint64_t>;
+
+struct ParsedTerm final {
+  Exponents exponents;
+
+  Rational coeff = 1;
+};
+
+using ParsedPolynom = std::vector<ParsedTerm>;
+
+class PolynomConverter final {
+public:
+  std::optional<ParsedPolynom> parse(const ArgumentPtr &arg) {
+    ParsedPolynom polynom;
+
+    for (const auto &child : getPolynomChildren(Add{}, arg)) {
+      ParsedTerm term;
+
+      if (!parseFactor(child, term)) {
+        return {};
+      }
+
+      polynom.emplace_back(std::move(term));
+    }
+
+    return polynom;
+  }
+
+  std::vector<uint64_t> getDegrees(const ParsedPolynom &polynom) const {
+    std::vector<uint64_t> degrees(atoms.size(), 0);
+
+    for (const auto &term : polynom) {
+      for (size_t i = 0; i < term.exponents.size(); i++) {
+        degrees[i] = std::max(degrees[i], term.exponents[i]);
+      }
+    }
+
+    return degrees;
+  }
+
+  bool initBits(const std::vector<uint64_t> &resultDegrees) {
+    const uint64_t maxDegree = resultDegrees.empty() ? 0 : std::ranges::max(resultDegrees);
+    bits = std::max<unsigned>(static_cast<unsigned>(std::bit_width(maxDegree)), 1);
+    return atoms.size() * bits <= std::numeric_limits<SparsePolynom::Monom>::digits;
+  }
+
+  SparsePolynom toPolynom(const ParsedPolynom &polynom) const {
+    std::vector<SparsePolynom::Term> terms;
+    terms.reserve(polynom.size());
+
+    for (const auto &term : polynom) {
+      SparsePolynom::Monom monom = 0;
+
+      for (size_t i = 0; i < term.exponents.size(); i++) {
+        monom |= term.exponents[i] << getShift(i);
+      }
+
+      terms.emplace_back(monom, term.coeff);
+    }
+
+    return SparsePolynom(std::move(terms));
+  }
+
+  ArgumentPtr toArgument(const SparsePolynom &polynom) const {
+    const SparsePolynom::Monom mask = (SparsePolynom::Monom(1) << bits) - 1;
+
+    ArgumentPtrVector children;
+    children.reserve(polynom.getTerms().size());
+
+    for (const auto &[monom, coeff] : polynom.getTerms()) {
+      ArgumentPtrVector factors;
+
+      if (coeff != 1 || monom == 0) {
+        factors.emplace_back(coeff.toMinimalObject());
+      }
+
+      for (size_t i = 0; i < atoms.size(); i++) {
+        const SparsePolynom::Monom exponent = (monom >> getShift(i)) & mask;
+
+        if (exponent == 1) {
+          factors.emplace_back(atoms[i]);
+        }
+        else if (exponent > 1) {
+          factors.emplace_back(powExpr(atoms[i], Integer(exponent).clone()));
+        }
+      }
+
+      children.emplace_back(factors.size() == 1 ? factors.front() : mulExpr(std::move(factors)));
+    }
+
+    if (children.empty()) {
+      return Integer(0).clone();
+    }
+
+    if (children.size() == 1) {
+      return children.front();
+    }
+
+    return addExpr(std::move(children));
+  }
+
+private:
+  bool parseFactor(const ArgumentPtr &factor, ParsedTerm &term) {
+    if (const auto factorInt = cast<Integer>(factor)) {
+      term.coeff *= *factorInt;
+      return true;
+    }
+
+    if (const auto factorRat = cast<Rational>(factor)) {
+      term.coeff *= *factorRat;
+      return true;
+    }
+
+    if (is<INumber>(factor) || is<Undefined>(factor) || containsInfinity(factor)) {
+      return false;
+    }
+
+    if (const auto factorExpr = cast<IExpression>(factor)) {
+      if (is<Add>(factorExpr->getFunction())) {
+        return false;
+      }
+
+      if (is<Mul>(factorExpr->getFunction())) {
+        return std::ranges::all_of(factorExpr->getChildren(), [&](const ArgumentPtr &child) {
+          return parseFactor(child, term);
+        });
+      }
+
+      if (is<Pow>(factorExpr->getFunction())) {
+        const ArgumentPtr &base = factorExpr->getChildren().front();
+        const auto rate = cast<Integer>(factorExpr->getChildren().back());
+
+        if (rate && *rate > 0 && *rate <= std::numeric_limits<uint32_t>::max()) {
+          if (const auto baseExpr = cast<IExpression>(base); baseExpr && is<Add>(baseExpr->getFunction())) {
+            return false;
+          }
+
+          addExponent(term, base, static_cast<uint64_t>(*rate));
+          return true;
+        }
+      }
+    }
+
+    addExponent(term, factor, 1);
+    return true;
+  }
+
+  void addExponent(ParsedTerm &term, const ArgumentPtr &atom, uint64_t exponent) {
+    const auto iter = std::ranges::find_if(atoms, [&](const ArgumentPtr &other) {
+      return *other == *atom;
+    });
+    const auto index = static_cast<size_t>(iter - atoms.begin());
+
+    if (iter == atoms.end()) {
+      atoms.emplace_back(atom);
+    }
+
+    if (term.exponents.size() <= index) {
+      term.exponents.resize(index + 1, 0);
+    }
+
+    term.exponents[index] += exponent;
+  }
+
+  // The first atom takes the most significant bits
+  unsigned getShift(size_t index) const {
+    return static_cast<unsigned>((atoms.size() - index - 1) * bits);
+  }
+
+private:
+  ArgumentPtrVector atoms;
+
+  unsigned bits = 1;
+};
+
+}
+
+SparsePolynom::SparsePolynom(std::vector<Term> inTerms) {
+  std::ranges::sort(inTerms, std::greater{}, &Term::monom);
+
+  for (auto &term : inTerms) {
+    if (!terms.empty() && terms.back().monom == term.monom) {
+      terms.back().coeff += term.coeff;
+    }
+    else {
+      terms.emplace_back(std::move(term));
+    }
+  }
+
+  std::erase_if(terms, [](const Term &term) { return term.coeff == 0; });
+}
+
+const std::vector<SparsePolynom::Term> &SparsePolynom::getTerms() const noexcept {
+  return terms;
+}
+
+SparsePolynom SparsePolynom::operator*(const SparsePolynom &rhs) const {
+  SparsePolynom res;
+
+  if (terms.empty() || rhs.terms.empty()) {
+    return res;
+  }
+
+  const Monom range = terms.front().monom + rhs.terms.front().monom -
+                      terms.back().monom - rhs.terms.back().monom + 1;
+
+  if (range <= denseRangeLimit && range <= denseRangeFactor * terms.size() * rhs.terms.size()) {
+    res.terms = mulDense(terms, rhs.terms);
+  }
+  else if (terms.size() <= rhs.terms.size()) {
+    res.terms = mulHeap(terms, rhs.terms);
+  }
+  else {
+    res.terms = mulHeap(rhs.terms, terms);
+  }
+
+  return res;
+}
+
+SparsePolynom SparsePolynom::pow(const size_t power) const {
+  if (power == 0) {
+    return SparsePolynom({{0, 1}});
+  }
+
+  // Multiplying by the short base keeps heaps small, squaring would multiply two long polynomials
+  SparsePolynom res = *this;
+
+  for (size_t i = 1; i < power; i++) {
+    res = res * *this;
+  }
+
+  return res;
+}
+
+// Johnson's algorithm: the heap holds one pending product for every term of lhs,
+// so the products are generated in descending order of monomials and equal ones are merged on the fly
+std::vector<SparsePolynom::Term> SparsePolynom::mulHeap(const std::vector<Term> &lhs, const std::vector<Term> &rhs) {
+  struct HeapEntry final {
+    Monom monom = 0;
+
+    size_t lhsIndex = 0;
+
+    size_t rhsIndex = 0;
+
+    bool operator<(const HeapEntry &other) const {
+      return monom < other.monom;
+    }
+  };
+
+  std::priority_queue<HeapEntry> heap;
+
+  for (size_t i = 0; i < lhs.size(); i++) {
+    heap.emplace(lhs[i].monom + rhs.front().monom, i, 0);
+  }
+
+  std::vector<Term> res;
+
+  while (!heap.empty()) {
+    const Monom monom = heap.top().monom;
+    RationalAccumulator coeff;
+
+    while (!heap.empty() && heap.top().monom == monom) {
+      const auto [entryMonom, lhsIndex, rhsIndex] = heap.top();
+      heap.pop();
+
+      coeff.addProduct(lhs[lhsIndex].coeff, rhs[rhsIndex].coeff);
+
+      if (rhsIndex + 1 < rhs.size()) {
+        heap.emplace(lhs[lhsIndex].monom + rhs[rhsIndex + 1].monom, lhsIndex, rhsIndex + 1);
+      }
+    }
+
+    if (!coeff.isZero()) {
+      res.emplace_back(monom, coeff.toRational());
+    }
+  }
+
+  return res;
+}
+
+// Kronecker substitution: packed monomials are already integers, so they are used as indices of a dense array
+std::vector<SparsePolynom::Term> SparsePolynom::mulDense(const std::vector<Term> &lhs, const std::vector<Term> &rhs) {
+  const Monom minMonom = lhs.back().monom + rhs.back().monom;
+  const Monom maxMonom = lhs.front().monom + rhs.front().monom;
+
+  std::vector<RationalAccumulator> coeffs(maxMonom - minMonom + 1);
+
+  for (const auto &lhsTerm : lhs) {
+    for (const auto &rhsTerm : rhs) {
+      coeffs[lhsTerm.monom + rhsTerm.monom - minMonom].addProduct(lhsTerm.coeff, rhsTerm.coeff);
+    }
+  }
+
+  std::vector<Term> res;
+
+  for (size_t i = coeffs.size(); i > 0; i--) {
+    if (!coeffs[i - 1].isZero()) {
+      res.emplace_back(minMonom + i - 1, coeffs[i - 1].toRational());
+    }
+  }
+
+  return res;
+}
+
+ArgumentPtr mulPolynoms(const ArgumentPtr &lhs, const ArgumentPtr &rhs) {
+  PolynomConverter converter;
+
+  const std::optional<ParsedPolynom> lhsParsed = converter.parse(lhs);
+
+  if (!lhsParsed) {
+    return {};
+  }
+
+  const std::optional<ParsedPolynom> rhsParsed = converter.parse(rhs);
+
+  if (!rhsParsed) {
+    return {};
+  }
+
+  std::vector<uint64_t> degrees = converter.getDegrees(*lhsParsed);
+  const std::vector<uint64_t> rhsDegrees = converter.getDegrees(*rhsParsed);
+
+  for (size_t i = 0; i < degrees.size(); i++) {
+    degrees[i] += rhsDegrees[i];
+  }
+
+  if (!converter.initBits(degrees)) {
+    return {};
+  }
+
+  return converter.toArgument(converter.toPolynom(*lhsParsed) * converter.toPolynom(*rhsParsed));
+}
+
+ArgumentPtr powPolynom(const ArgumentPtr &base, const Integer &power) {
+  if (power < 0 || power > std::numeric_limits<uint32_t>::max()) {
+    return {};
+  }
+
+  PolynomConverter converter;
+
+  const std::optional<ParsedPolynom> parsed = converter.parse(base);
+
+  if (!parsed) {
+    return {};
+  }
+
+  const auto powerValue = static_cast<uint64_t>(power);
+  std::vector<uint64_t> degrees = converter.getDegrees(*parsed);
+
+  for (auto &degree : degrees) {
+    degree *= powerValue;
+  }
+
+  if (!converter.initBits(degrees)) {
+    return {};
+  }
+
+  return converter.toArgument(converter.toPolynom(*parsed).pow(powerValue));
+}
+
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "fintamath/functions/FunctionArguments.hpp"
+#include "fintamath/numbers/Integer.hpp"
+#include "fintamath/numbers/Rational.hpp"
+
+namespace fintamath::detail {
+
+// Sparse multivariate polynomial with rational coefficients.
+// Exponents of a monomial are packed into one word with a fixed number of bits per variable,
+// so monomials are multiplied by adding the words and compared by comparing them.
+class SparsePolynom final {
+public:
+  using Monom = uint64_t;
+
+  struct Term final {
+    Monom monom = 0;
+
+    Rational coeff;
+  };
+
+public:
+  SparsePolynom() = default;
+
+  // Terms may be in any order, equal monomials are merged and zero terms are removed
+  explicit SparsePolynom(std::vector<Term> inTerms);
+
+  const std::vector<Term> &getTerms() const noexcept;
+
+  // Exponents of the result must fit into their bits
+  SparsePolynom operator*(const SparsePolynom &rhs) const;
+
+  SparsePolynom pow(size_t power) const;
+
+private:
+  static std::vector<Term> mulHeap(const std::vector<Term> &lhs, const std::vector<Term> &rhs);
+
+  static std::vector<Term> mulDense(const std::vector<Term> &lhs, const std::vector<Term> &rhs);
+
+private:
+  // Monomials are in descending order
+  std::vector<Term> terms;
+};
+
+// Expand products and integer powers of sums with rational coefficients.
+// Factors which are not polynomials are used as variables, nullptr is returned if an argument can not be converted.
+
+ArgumentPtr mulPolynoms(const ArgumentPtr &lhs, const ArgumentPtr &rhs);
+
+ArgumentPtr powPolynom(const ArgumentPtr &base, const Integer &power);
+
+}
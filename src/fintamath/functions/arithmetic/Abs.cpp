@@ -14,6 +14,8 @@
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/RationalFunctions.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -44,6 +46,10 @@ std::unique_ptr<IMathObject> Abs::multiAbsSimplify(const INumber &rhs) {
       return abs(inRhs).clone();
     });
 
+    outMultiAbs.add<RealBall>([](const RealBall &inRhs) {
+      return abs(inRhs).clone();
+    });
+
     outMultiAbs.add<Complex>([](const Complex &inRhs) {
       // https://en.wikipedia.org/wiki/Absolute_value#Complex_numbers
       const auto sumOfSquares = *(inRhs.real() * inRhs.real()) + *(inRhs.imag() * inRhs.imag());
@@ -12,6 +12,7 @@
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
 
 namespace fintamath {
 
@@ -33,6 +34,14 @@ std::unique_ptr<IMathObject> Sign::multiSignSimplify(const INumber &rhs) {
       return Integer(inRhs.sign()).clone();
     });
 
+    outMultiSign.add<RealBall>([](const RealBall &inRhs) {
+      if (inRhs.containsZero()) {
+        return std::unique_ptr<IMathObject>{};
+      }
+
+      return Integer(inRhs.sign()).clone();
+    });
+
     outMultiSign.add<Rational>([](const Rational &inRhs) {
       return Integer(inRhs.sign()).clone();
     });
@@ -11,6 +11,8 @@
 #include "fintamath/literals/constants/I.hpp"
 #include "fintamath/literals/constants/Pi.hpp"
 #include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -52,7 +54,11 @@ std::unique_ptr<IMathObject> Acosh::multiAcoshSimplify(const INumber &rhs) {
     });
 
     outMultiAcosh.add<Real>([](const Real &inRhs) {
-      return acosh(inRhs).clone();
+      return cloneIfDefined(tryAcosh(inRhs));
+    });
+
+    outMultiAcosh.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryAcosh(inRhs));
     });
 
     return outMultiAcosh;
@@ -13,6 +13,8 @@
 #include "fintamath/literals/constants/NegInf.hpp"
 #include "fintamath/literals/constants/Pi.hpp"
 #include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -53,7 +55,11 @@ std::unique_ptr<IMathObject> Acoth::multiAcothSimplify(const INumber &rhs) {
     });
 
     outMultiAcoth.add<Real>([](const Real &inRhs) {
-      return acoth(inRhs).clone();
+      return cloneIfDefined(tryAcoth(inRhs));
+    });
+
+    outMultiAcoth.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryAcoth(inRhs));
     });
 
     return outMultiAcoth;
@@ -13,6 +13,8 @@
 #include "fintamath/numbers/INumber.hpp"
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -53,7 +55,11 @@ std::unique_ptr<IMathObject> Asech::multiAsechSimplify(const INumber &rhs) {
     });
 
     outMultiAsech.add<Real>([](const Real &inRhs) {
-      return asech(inRhs).clone();
+      return cloneIfDefined(tryAsech(inRhs));
+    });
+
+    outMultiAsech.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryAsech(inRhs));
     });
 
     return outMultiAsech;
@@ -10,6 +10,8 @@
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -41,7 +43,11 @@ std::unique_ptr<IMathObject> Asinh::multiAsinhSimplify(const INumber &rhs) {
     });
 
     outMultiAsinh.add<Real>([](const Real &inRhs) {
-      return asinh(inRhs).clone();
+      return cloneIfDefined(tryAsinh(inRhs));
+    });
+
+    outMultiAsinh.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryAsinh(inRhs));
     });
 
     return outMultiAsinh;
@@ -11,6 +11,8 @@
 #include "fintamath/numbers/INumber.hpp"
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -50,7 +52,11 @@ std::unique_ptr<IMathObject> Atanh::multiAtanhSimplify(const INumber &rhs) {
     });
 
     outMultiAtanh.add<Real>([](const Real &inRhs) {
-      return atanh(inRhs).clone();
+      return cloneIfDefined(tryAtanh(inRhs));
+    });
+
+    outMultiAtanh.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryAtanh(inRhs));
     });
 
     return outMultiAtanh;
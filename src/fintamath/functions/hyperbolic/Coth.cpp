@@ -11,6 +11,8 @@
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -42,7 +44,11 @@ std::unique_ptr<IMathObject> Coth::multiCothSimplify(const INumber &rhs) {
     });
 
     outMultiCoth.add<Real>([](const Real &inRhs) {
-      return coth(inRhs).clone();
+      return cloneIfDefined(tryCoth(inRhs));
+    });
+
+    outMultiCoth.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryCoth(inRhs));
     });
 
     return outMultiCoth;
@@ -9,6 +9,8 @@
 #include "fintamath/numbers/INumber.hpp"
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -40,7 +42,11 @@ std::unique_ptr<IMathObject> Sech::multiSechSimplify(const INumber &rhs) {
     });
 
     outMultiSech.add<Real>([](const Real &inRhs) {
-      return sech(inRhs).clone();
+      return cloneIfDefined(trySech(inRhs));
+    });
+
+    outMultiSech.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(trySech(inRhs));
     });
 
     return outMultiSech;
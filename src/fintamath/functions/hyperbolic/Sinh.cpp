@@ -9,6 +9,8 @@
 #include "fintamath/numbers/INumber.hpp"
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -40,7 +42,11 @@ std::unique_ptr<IMathObject> Sinh::multiSinhSimplify(const INumber &rhs) {
     });
 
     outMultiSinh.add<Real>([](const Real &inRhs) {
-      return sinh(inRhs).clone();
+      return cloneIfDefined(trySinh(inRhs));
+    });
+
+    outMultiSinh.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(trySinh(inRhs));
     });
 
     return outMultiSinh;
@@ -10,6 +10,8 @@
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -41,7 +43,11 @@ std::unique_ptr<IMathObject> Tanh::multiTanhSimplify(const INumber &rhs) {
     });
 
     outMultiTanh.add<Real>([](const Real &inRhs) {
-      return tanh(inRhs).clone();
+      return cloneIfDefined(tryTanh(inRhs));
+    });
+
+    outMultiTanh.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryTanh(inRhs));
     });
 
     return outMultiTanh;
@@ -11,6 +11,8 @@
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -46,7 +48,11 @@ std::unique_ptr<IMathObject> Ln::multiLnSimplify(const INumber &rhs) {
     });
 
     outMultiLn.add<Real>([](const Real &inRhs) {
-      return ln(inRhs).clone();
+      return cloneIfDefined(tryLn(inRhs));
+    });
+
+    outMultiLn.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryLn(inRhs));
     });
 
     return outMultiLn;
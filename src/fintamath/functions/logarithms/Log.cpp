@@ -17,6 +17,8 @@
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -105,6 +107,10 @@ std::unique_ptr<IMathObject> Log::multiLogSimplify(const INumber &lhs, const INu
       return logSimplify(inLhs, inRhs);
     });
 
+    outMultiPow.add<RealBall, RealBall>([](const RealBall &inLhs, const RealBall &inRhs) {
+      return logSimplify(inLhs, inRhs);
+    });
+
     return outMultiPow;
   }();
 
@@ -145,7 +151,11 @@ std::unique_ptr<IMathObject> Log::logSimplify(const Rational &lhs, const Rationa
 }
 
 std::unique_ptr<IMathObject> Log::logSimplify(const Real &lhs, const Real &rhs) {
-  return log(lhs, rhs).clone();
+  return cloneIfDefined(tryLog(lhs, rhs));
+}
+
+std::unique_ptr<IMathObject> Log::logSimplify(const RealBall &lhs, const RealBall &rhs) {
+  return cloneIfDefined(tryLog(lhs, rhs));
 }
 
 }
@@ -14,6 +14,8 @@
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/RationalFunctions.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -45,13 +47,17 @@ std::unique_ptr<IMathObject> Ceil::multiCeilSimplify(const INumber &rhs) {
         return std::unique_ptr<IMathObject>{};
       }
 
-      Integer res = ceil(inRhs);
+      auto res = tryCeil(inRhs);
 
-      if (inRhs == res) {
+      if (!res || inRhs == *res) {
         return std::unique_ptr<IMathObject>{};
       }
 
-      return std::move(res).clone();
+      return std::move(*res).clone();
+    });
+
+    outMultiCeil.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryCeil(inRhs));
     });
 
     outMultiCeil.add<Complex>([](const Complex &inRhs) {
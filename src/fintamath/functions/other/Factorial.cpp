@@ -77,7 +77,7 @@ std::unique_ptr<IMathObject> Factorial::factorialSimplify(const Real &rhs, const
     return {};
   }
 
-  return tgamma(rhs + 1).clone();
+  return cloneIfDefined(tryTgamma(rhs + 1));
 }
 
 }
@@ -1,6 +1,7 @@
 #include "fintamath/functions/powers/Pow.hpp"
 
 #include <memory>
+#include <optional>
 
 #include "fintamath/core/Converter.hpp"
 #include "fintamath/core/IMathObject.hpp"
@@ -11,11 +12,15 @@
 #include "fintamath/literals/constants/ComplexInf.hpp"
 #include "fintamath/literals/constants/Undefined.hpp"
 #include "fintamath/numbers/Complex.hpp"
+#include "fintamath/numbers/ComplexFunctions.hpp"
 #include "fintamath/numbers/INumber.hpp"
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/IntegerFunctions.hpp"
 #include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/RationalFunctions.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -67,6 +72,14 @@ std::unique_ptr<IMathObject> Pow::multiPowSimplify(const INumber &lhs, const INu
       return powSimplify(inLhs, inRhs);
     });
 
+    outMultiPow.add<Real, Integer>([](const Real &inLhs, const Integer &inRhs) {
+      return powSimplify(inLhs, inRhs);
+    });
+
+    outMultiPow.add<RealBall, RealBall>([](const RealBall &inLhs, const RealBall &inRhs) {
+      return powSimplify(inLhs, inRhs);
+    });
+
     outMultiPow.add<Complex, Complex>([](const Complex &inLhs, const Complex &inRhs) {
       return powSimplify(inLhs, inRhs);
     });
@@ -74,6 +87,11 @@ std::unique_ptr<IMathObject> Pow::multiPowSimplify(const INumber &lhs, const INu
     return outMultiPow;
   }();
 
+  // Integer exponents have their own kernels, so they are not converted to the base type
+  if (multiPow.contains(lhs, rhs)) {
+    return multiPow(lhs, rhs);
+  }
+
   if (const auto rhsConv = convert(lhs, rhs)) {
     return multiPow(lhs, *rhsConv);
   }
@@ -108,6 +126,13 @@ std::unique_ptr<IMathObject> Pow::powSimplify(const Rational &lhs, const Rationa
     return {};
   }
 
+  // Roots of perfect powers are exact, so the power is computed on the smaller root
+  if (lhs >= 0) {
+    if (const std::optional<Rational> lhsRoot = perfectRoot(lhs, rhsDenominator)) {
+      return pow(*lhsRoot, rhsNumerator).toMinimalObject();
+    }
+  }
+
   if (lhsDenominator == 1) {
     return Root{}(*multiPowSimplify(lhsNumerator, rhsNumerator), rhsDenominator);
   }
@@ -116,7 +141,15 @@ std::unique_ptr<IMathObject> Pow::powSimplify(const Rational &lhs, const Rationa
 }
 
 std::unique_ptr<IMathObject> Pow::powSimplify(const Real &lhs, const Real &rhs) {
-  return pow(lhs, rhs).clone();
+  return cloneIfDefined(tryPow(lhs, rhs));
+}
+
+std::unique_ptr<IMathObject> Pow::powSimplify(const Real &lhs, const Integer &rhs) {
+  return cloneIfDefined(tryPow(lhs, rhs));
+}
+
+std::unique_ptr<IMathObject> Pow::powSimplify(const RealBall &lhs, const RealBall &rhs) {
+  return cloneIfDefined(tryPow(lhs, rhs));
 }
 
 std::unique_ptr<IMathObject> Pow::powSimplify(const Complex &lhs, const Complex &rhs) {
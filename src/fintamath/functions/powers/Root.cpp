@@ -104,7 +104,17 @@ Root::RootToFactorMap Root::roots(const Integer &lhs, const Integer &rhs) {
   const FactorToCountMap factorToCountMap = factors(lhs, factorLimit);
   RootToFactorMap rootToFactorMap{{1, 1}};
 
-  for (const auto &[factor, rate] : factorToCountMap) {
+  for (const auto &[factorValue, rateValue] : factorToCountMap) {
+    Integer factor = factorValue;
+    Integer rate = rateValue;
+
+    // The rest above the limit is not factorized, but it is cheap to reduce if it is a perfect power
+    if (factor > factorLimit) {
+      Integer degree;
+      factor = perfectPowerBase(factor, degree);
+      rate *= degree;
+    }
+
     const Rational power(rate, rhs);
 
     if (power.denominator() == 1) {
@@ -134,13 +144,11 @@ std::unique_ptr<IMathObject> Root::perfectRoot(const Integer &lhs, const Integer
     return lhs.clone();
   }
 
-  if (rhs == 2) { // TODO: perfect nth-roots
-    Integer remainder;
-    const Integer lhsSqrt = sqrt(lhs, remainder);
+  Integer remainder;
+  const Integer lhsRoot = root(lhs, rhs, remainder);
 
-    if (remainder == 0) {
-      return lhsSqrt.clone();
-    }
+  if (remainder == 0) {
+    return lhsRoot.clone();
   }
 
   return {};
@@ -9,6 +9,8 @@
 #include "fintamath/functions/arithmetic/Div.hpp"
 #include "fintamath/literals/constants/Pi.hpp"
 #include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -48,7 +50,11 @@ std::unique_ptr<IMathObject> Acos::multiAcosSimplify(const INumber &rhs) {
     });
 
     outMultiAcos.add<Real>([](const Real &inRhs) {
-      return acos(inRhs).clone();
+      return cloneIfDefined(tryAcos(inRhs));
+    });
+
+    outMultiAcos.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryAcos(inRhs));
     });
 
     return outMultiAcos;
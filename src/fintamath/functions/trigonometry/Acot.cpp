@@ -11,6 +11,8 @@
 #include "fintamath/literals/constants/Pi.hpp"
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -50,7 +52,11 @@ std::unique_ptr<IMathObject> Acot::multiAcotSimplify(const INumber &rhs) {
     });
 
     outMultiAcot.add<Real>([](const Real &inRhs) {
-      return acot(inRhs).clone();
+      return cloneIfDefined(tryAcot(inRhs));
+    });
+
+    outMultiAcot.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryAcot(inRhs));
     });
 
     return outMultiAcot;
@@ -11,6 +11,8 @@
 #include "fintamath/literals/constants/ComplexInf.hpp"
 #include "fintamath/literals/constants/Pi.hpp"
 #include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -50,7 +52,11 @@ std::unique_ptr<IMathObject> Acsc::multiAcscSimplify(const INumber &rhs) {
     });
 
     outMultiAcsc.add<Real>([](const Real &inRhs) {
-      return acsc(inRhs).clone();
+      return cloneIfDefined(tryAcsc(inRhs));
+    });
+
+    outMultiAcsc.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryAcsc(inRhs));
     });
 
     return outMultiAcsc;
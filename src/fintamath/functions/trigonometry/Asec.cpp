@@ -11,6 +11,8 @@
 #include "fintamath/numbers/INumber.hpp"
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -50,7 +52,11 @@ std::unique_ptr<IMathObject> Asec::multiAsecSimplify(const INumber &rhs) {
     });
 
     outMultiAsec.add<Real>([](const Real &inRhs) {
-      return asec(inRhs).clone();
+      return cloneIfDefined(tryAsec(inRhs));
+    });
+
+    outMultiAsec.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryAsec(inRhs));
     });
 
     return outMultiAsec;
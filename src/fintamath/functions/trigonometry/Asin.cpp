@@ -10,6 +10,8 @@
 #include "fintamath/functions/arithmetic/Neg.hpp"
 #include "fintamath/literals/constants/Pi.hpp"
 #include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -49,7 +51,11 @@ std::unique_ptr<IMathObject> Asin::multiAsinSimplify(const INumber &rhs) {
     });
 
     outMultiAsin.add<Real>([](const Real &inRhs) {
-      return asin(inRhs).clone();
+      return cloneIfDefined(tryAsin(inRhs));
+    });
+
+    outMultiAsin.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryAsin(inRhs));
     });
 
     return outMultiAsin;
@@ -11,6 +11,8 @@
 #include "fintamath/literals/constants/Pi.hpp"
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -50,7 +52,11 @@ std::unique_ptr<IMathObject> Atan::multiAtanSimplify(const INumber &rhs) {
     });
 
     outMultiAtan.add<Real>([](const Real &inRhs) {
-      return atan(inRhs).clone();
+      return cloneIfDefined(tryAtan(inRhs));
+    });
+
+    outMultiAtan.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryAtan(inRhs));
     });
 
     return outMultiAtan;
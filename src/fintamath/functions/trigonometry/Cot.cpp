@@ -10,6 +10,8 @@
 #include "fintamath/numbers/INumber.hpp"
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -41,7 +43,11 @@ std::unique_ptr<IMathObject> Cot::multiCotSimplify(const INumber &rhs) {
     });
 
     outMultiCot.add<Real>([](const Real &inRhs) {
-      return cot(inRhs).clone();
+      return cloneIfDefined(tryCot(inRhs));
+    });
+
+    outMultiCot.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryCot(inRhs));
     });
 
     return outMultiCot;
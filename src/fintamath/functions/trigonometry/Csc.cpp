@@ -10,6 +10,8 @@
 #include "fintamath/numbers/INumber.hpp"
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+#include "fintamath/numbers/RealBallFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -41,7 +43,11 @@ std::unique_ptr<IMathObject> Csc::multiCscSimplify(const INumber &rhs) {
     });
 
     outMultiCsc.add<Real>([](const Real &inRhs) {
-      return csc(inRhs).clone();
+      return cloneIfDefined(tryCsc(inRhs));
+    });
+
+    outMultiCsc.add<RealBall>([](const RealBall &inRhs) {
+      return cloneIfDefined(tryCsc(inRhs));
     });
 
     return outMultiCsc;
@@ -1,9 +1,13 @@
 #include "fintamath/numbers/Complex.hpp"
 
+#include <algorithm>
 #include <compare>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
 #include <fmt/core.h>
 
@@ -21,16 +25,135 @@ namespace fintamath {
 
 FINTAMATH_CLASS_IMPLEMENTATION(Complex)
 
-Complex::Complex(const Complex &rhs) : re(cast<INumber>(rhs.re->clone())), im(cast<INumber>(rhs.im->clone())) {
+namespace {
+
+using Part = std::variant<Integer, Rational, Real>;
+
+Part toPart(Integer rhs) {
+  return rhs;
 }
 
-Complex &Complex::operator=(const Complex &rhs) {
-  if (this != &rhs) {
-    re = cast<INumber>(rhs.re->clone());
-    im = cast<INumber>(rhs.im->clone());
+Part toPart(Rational rhs) {
+  if (rhs.denominator() == 1) {
+    return rhs.numerator();
   }
 
-  return *this;
+  return rhs;
+}
+
+Part toPart(Real rhs) {
+  return rhs;
+}
+
+Part toPart(const INumber &rhs) {
+  if (const auto *intRhs = cast<Integer>(&rhs)) {
+    return *intRhs;
+  }
+
+  if (const auto *ratRhs = cast<Rational>(&rhs)) {
+    return toPart(*ratRhs);
+  }
+
+  if (const auto *realRhs = cast<Real>(&rhs)) {
+    return *realRhs;
+  }
+
+  throw InvalidInputException(fmt::format(
+      R"({} is not supported as a part of {})",
+      rhs.getClass()->getName(),
+      Complex::getClassStatic()->getName()));
+}
+
+const INumber &toNumber(const Part &rhs) {
+  return std::visit([](const auto &val) -> const INumber & { return val; }, rhs);
+}
+
+bool isZero(const Part &rhs) {
+  return std::visit([](const auto &val) { return val == 0; }, rhs);
+}
+
+// Real zeros are approximate and keep their sign, so only Integer zeros are exact
+bool isExactZero(const Part &rhs) {
+  const auto *intRhs = std::get_if<Integer>(&rhs);
+  return intRhs && *intRhs == 0;
+}
+
+// Converts the lower part to the type of the higher one in the order Integer, Rational, Real
+template <typename Function>
+auto visitPromoted(const Part &lhs, const Part &rhs, Function &&func) {
+  return std::visit([&func]<typename Lhs, typename Rhs>(const Lhs &lhsVal, const Rhs &rhsVal) {
+    if constexpr (std::is_same_v<Lhs, Rhs>) {
+      return func(lhsVal, rhsVal);
+    }
+    else if constexpr (std::is_same_v<Lhs, Real> || (std::is_same_v<Lhs, Rational> && std::is_same_v<Rhs, Integer>)) {
+      return func(lhsVal, Lhs(rhsVal));
+    }
+    else {
+      return func(Rhs(lhsVal), rhsVal);
+    }
+  },
+                    lhs, rhs);
+}
+
+Part operator+(const Part &lhs, const Part &rhs) {
+  if (isExactZero(rhs)) {
+    return lhs;
+  }
+
+  if (isExactZero(lhs)) {
+    return rhs;
+  }
+
+  return visitPromoted(lhs, rhs, [](const auto &lhsVal, const auto &rhsVal) { return toPart(lhsVal + rhsVal); });
+}
+
+Part operator-(const Part &rhs) {
+  return std::visit([](const auto &val) { return toPart(-val); }, rhs);
+}
+
+Part operator-(const Part &lhs, const Part &rhs) {
+  if (isExactZero(rhs)) {
+    return lhs;
+  }
+
+  if (isExactZero(lhs)) {
+    return -rhs;
+  }
+
+  return visitPromoted(lhs, rhs, [](const auto &lhsVal, const auto &rhsVal) { return toPart(lhsVal - rhsVal); });
+}
+
+Part operator*(const Part &lhs, const Part &rhs) {
+  if (isExactZero(lhs) || isExactZero(rhs)) {
+    return Integer(0);
+  }
+
+  return visitPromoted(lhs, rhs, [](const auto &lhsVal, const auto &rhsVal) { return toPart(lhsVal * rhsVal); });
+}
+
+Part operator/(const Part &lhs, const Part &rhs) {
+  if (isExactZero(lhs) && !isZero(rhs)) {
+    return Integer(0);
+  }
+
+  return visitPromoted(lhs, rhs, []<typename T>(const T &lhsVal, const T &rhsVal) {
+    if constexpr (std::is_same_v<T, Integer>) {
+      return toPart(Rational(lhsVal, rhsVal));
+    }
+    else {
+      return toPart(lhsVal / rhsVal);
+    }
+  });
+}
+
+bool operator==(const Part &lhs, const Part &rhs) {
+  return visitPromoted(lhs, rhs, [](const auto &lhsVal, const auto &rhsVal) { return lhsVal == rhsVal; });
+}
+
+std::strong_ordering operator<=>(const Part &lhs, const Part &rhs) {
+  return visitPromoted(lhs, rhs, [](const auto &lhsVal, const auto &rhsVal) { return lhsVal <=> rhsVal; });
+}
+
 }
 
 Complex::Complex(const INumber &inRe, const INumber &inIm) {
@@ -40,30 +163,28 @@ Complex::Complex(const INumber &inRe, const INumber &inIm) {
         getClassStatic()->getName()));
   }
 
-  re = cast<INumber>(inRe.toMinimalObject());
-  im = cast<INumber>(inIm.toMinimalObject());
+  re = toPart(inRe);
+  im = toPart(inIm);
 }
 
-Complex::Complex(const Integer &rhs) : re(cast<INumber>(rhs.toMinimalObject())) {
+Complex::Complex(const Integer &rhs) : re(rhs) {
 }
 
-Complex::Complex(const Rational &rhs) : re(cast<INumber>(rhs.toMinimalObject())) {
+Complex::Complex(const Rational &rhs) : re(toPart(rhs)) {
 }
 
-Complex::Complex(const Real &rhs) : re(cast<INumber>(rhs.toMinimalObject())) {
+Complex::Complex(const Real &rhs) : re(rhs) {
 }
 
 Complex::Complex(const std::string &str) try {
-  if (!str.empty() && str.back() == 'I') {
-    im = parseNonComplexNumber(str.substr(0, str.size() - 1));
-  }
-  else {
-    re = parseNonComplexNumber(str);
-  }
+  const bool isImag = !str.empty() && str.back() == 'I';
+  const std::unique_ptr<INumber> num = parseNonComplexNumber(isImag ? str.substr(0, str.size() - 1) : str);
 
-  if (!re || !im) {
+  if (!num) {
     throw InvalidInputException("");
   }
+
+  (isImag ? im : re) = toPart(*num);
 }
 catch (const InvalidInputException &) {
   throw InvalidInputException(fmt::format(
@@ -75,12 +196,12 @@ catch (const InvalidInputException &) {
 std::string Complex::toString() const {
   std::string res;
 
-  if (*re != Integer(0)) {
-    res += re->toString();
+  if (!isExactZero(re)) {
+    res += real().toString();
   }
 
-  if (*im != Integer(0)) {
-    std::string imStr = im->toString();
+  if (!isExactZero(im)) {
+    std::string imStr = imag().toString();
     bool isImNeg = false;
 
     if (imStr.front() == '-') {
@@ -88,7 +209,7 @@ std::string Complex::toString() const {
       isImNeg = true;
     }
 
-    if (*im == Integer(1) || *im == Integer(-1)) {
+    if (im == Part(Integer(1)) || im == Part(Integer(-1))) {
       imStr.clear();
     }
     else {
@@ -113,16 +234,16 @@ std::string Complex::toString() const {
 }
 
 std::unique_ptr<IMathObject> Complex::toMinimalObject() const {
-  if (*im == Integer(0)) {
-    return re->toMinimalObject();
+  if (isExactZero(im)) {
+    return real().toMinimalObject();
   }
 
   return clone();
 }
 
 std::optional<unsigned> Complex::getPrecision() const noexcept {
-  std::optional<unsigned> rePrecision = re->getPrecision();
-  std::optional<unsigned> imPrecision = im->getPrecision();
+  std::optional<unsigned> rePrecision = real().getPrecision();
+  std::optional<unsigned> imPrecision = imag().getPrecision();
 
   if (rePrecision && imPrecision) {
     return std::min(*rePrecision, *imPrecision);
@@ -140,76 +261,70 @@ std::optional<unsigned> Complex::getPrecision() const noexcept {
 }
 
 bool Complex::isComplex() const noexcept {
-  return *im != Integer(0);
+  return !isExactZero(im);
 }
 
 const INumber &Complex::real() const noexcept {
-  return *re;
+  return toNumber(re);
 }
 
 const INumber &Complex::imag() const noexcept {
-  return *im;
+  return toNumber(im);
 }
 
 bool Complex::equals(const Complex &rhs) const {
-  return *re == *rhs.re && *im == *rhs.im;
+  return re == rhs.re && im == rhs.im;
 }
 
 std::strong_ordering Complex::compare(const Complex &rhs) const {
-  if (*re == *rhs.re) {
-    return *im <=> *rhs.im;
+  if (re == rhs.re) {
+    return im <=> rhs.im;
   }
 
-  return *re <=> *rhs.re;
+  return re <=> rhs.re;
 }
 
 Complex &Complex::add(const Complex &rhs) {
-  re = *re + *rhs.re;
-  im = *im + *rhs.im;
+  re = re + rhs.re;
+  im = im + rhs.im;
 
   return *this;
 }
 
 Complex &Complex::substract(const Complex &rhs) {
-  re = *re - *rhs.re;
-  im = *im - *rhs.im;
+  re = re - rhs.re;
+  im = im - rhs.im;
 
   return *this;
 }
 
 // https://en.wikipedia.org/wiki/Complex_number#Multiplication_and_square
 Complex &Complex::multiply(const Complex &rhs) {
-  const Complex lhs = *this;
+  const Part &x = re;
+  const Part &y = im;
+  const Part &u = rhs.re;
+  const Part &v = rhs.im;
 
-  const auto &x = *lhs.re;
-  const auto &y = *lhs.im;
-  const auto &u = *rhs.re;
-  const auto &v = *rhs.im;
-
-  re = *(x * u) - *(y * v);
-  im = *(x * v) + *(y * u);
+  Part newRe = x * u - y * v;
+  im = x * v + y * u;
+  re = std::move(newRe);
 
   return *this;
 }
 
 // https://en.wikipedia.org/wiki/Complex_number#Reciprocal_and_division
 Complex &Complex::divide(const Complex &rhs) {
-  const Complex lhs = *this;
-
-  const auto &x = *lhs.re;
-  const auto &y = *lhs.im;
-  const auto &u = *rhs.re;
-  const auto &v = *rhs.im;
+  const Part &x = re;
+  const Part &y = im;
+  const Part &u = rhs.re;
+  const Part &v = rhs.im;
 
-  auto divisor = *(u * u) + *(v * v);
-
-  if (is<Integer>(divisor)) {
-    divisor = convert<Rational>(*divisor);
-  }
+  const Part divisor = u * u + v * v;
 
   try {
-    re = *(*(x * u) + *(y * v)) / *divisor;
-    im = *(*(y * u) - *(x * v)) / *divisor;
+    Part newRe = (x * u + y * v) / divisor;
+    im = (y * u - x * v) / divisor;
+    re = std::move(newRe);
   }
   catch (const UndefinedException &) {
     throw UndefinedException(fmt::format(
@@ -222,8 +337,8 @@ Complex &Complex::divide(const Complex &rhs) {
 }
 
 Complex &Complex::negate() {
-  re = -(*re);
-  im = -(*im);
+  re = -re;
+  im = -im;
   return *this;
 }
 
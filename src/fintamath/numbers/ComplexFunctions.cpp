@@ -0,0 +1,45 @@
+#include "fintamath/numbers/ComplexFunctions.hpp"
+
+#include <fmt/core.h>
+
+#include <boost/multiprecision/detail/default_ops.hpp>
+
+#include "fintamath/exceptions/UndefinedException.hpp"
+#include "fintamath/numbers/Complex.hpp"
+#include "fintamath/numbers/Integer.hpp"
+
+namespace fintamath {
+
+// Use left-to-right binary exponentiation over the bits of the exponent.
+// https://en.wikipedia.org/wiki/Exponentiation_by_squaring.
+Complex pow(const Complex &lhs, const Integer &rhs) {
+  if (lhs == 0 && rhs == 0) {
+    throw UndefinedException(fmt::format(
+        R"(pow({}, {}) is undefined (zero to the power of zero))",
+        lhs.toString(),
+        rhs.toString()));
+  }
+
+  if (rhs < 0) {
+    return pow(1 / lhs, -rhs);
+  }
+
+  if (rhs == 0) {
+    return 1;
+  }
+
+  const Integer::Backend exponent = rhs.getBackend();
+  Complex res = lhs;
+
+  for (auto bit = msb(exponent); bit > 0; bit--) {
+    res = res * res;
+
+    if (bit_test(exponent, bit - 1)) {
+      res = res * lhs;
+    }
+  }
+
+  return res;
+}
+
+}
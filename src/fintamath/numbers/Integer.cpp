@@ -1,11 +1,16 @@
 #include "fintamath/numbers/Integer.hpp"
 
+#include <algorithm>
+#include <charconv>
 #include <compare>
 #include <cstdint>
+#include <limits>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <utility>
+#include <variant>
 
 #include <fmt/core.h>
 
@@ -19,7 +24,58 @@ FINTAMATH_CLASS_IMPLEMENTATION(Integer)
 
 using namespace detail;
 
-Integer::Integer(Backend inBackend) : backend(std::move(inBackend)) {
+namespace {
+
+constexpr int64_t minSmallValue = std::numeric_limits<int64_t>::min();
+
+constexpr int64_t maxSmallValue = std::numeric_limits<int64_t>::max();
+
+constexpr int64_t maxSmallShift = std::numeric_limits<int64_t>::digits;
+
+// Overflow checks follow the CERT INT32-C rules
+
+bool tryAdd(const int64_t lhs, const int64_t rhs, int64_t &res) {
+  if ((rhs > 0 && lhs > maxSmallValue - rhs) || (rhs < 0 && lhs < minSmallValue - rhs)) {
+    return false;
+  }
+
+  res = lhs + rhs;
+  return true;
+}
+
+bool trySubstract(const int64_t lhs, const int64_t rhs, int64_t &res) {
+  if ((rhs > 0 && lhs < minSmallValue + rhs) || (rhs < 0 && lhs > maxSmallValue + rhs)) {
+    return false;
+  }
+
+  res = lhs - rhs;
+  return true;
+}
+
+bool tryMultiply(const int64_t lhs, const int64_t rhs, int64_t &res) {
+  if (lhs > 0) {
+    if (rhs > 0 ? lhs > maxSmallValue / rhs : rhs < minSmallValue / lhs) {
+      return false;
+    }
+  }
+  else if (rhs > 0 ? lhs < minSmallValue / rhs : lhs != 0 && rhs < maxSmallValue / lhs) {
+    return false;
+  }
+
+  res = lhs * rhs;
+  return true;
+}
+
+bool tryParse(const std::string_view str, int64_t &res) {
+  const char *end = str.data() + str.size();
+  const auto [ptr, errc] = std::from_chars(str.data(), end, res);
+  return errc == std::errc() && ptr == end;
+}
+
+}
+
+Integer::Integer(Backend inBackend) : value(std::move(inBackend)) {
+  normalize();
 }
 
 Integer::Integer(const std::string_view str) try {
@@ -27,12 +83,21 @@ Integer::Integer(const std::string_view str) try {
     throw InvalidInputException("");
   }
 
+  const std::string mutableStr = removeLeadingZeroes(std::string(str));
+
+  if (int64_t smallValue = 0; tryParse(mutableStr, smallValue)) {
+    value = smallValue;
+    return;
+  }
+
   try {
-    backend.assign(removeLeadingZeroes(std::string(str)));
+    value = Backend(mutableStr);
   }
   catch (const std::runtime_error &) {
     throw InvalidInputException("");
   }
+
+  normalize();
 }
 catch (const InvalidInputException &) {
   throw InvalidInputException(fmt::format(
@@ -42,37 +107,96 @@ catch (const InvalidInputException &) {
 }
 
 std::string Integer::toString() const {
-  return backend.str();
+  if (const auto *smallValue = std::get_if<int64_t>(&value)) {
+    return std::to_string(*smallValue);
+  }
+
+  return std::get<Backend>(value).str();
 }
 
 int Integer::sign() const {
-  return backend.sign();
+  if (const auto *smallValue = std::get_if<int64_t>(&value)) {
+    return (*smallValue > 0) - (*smallValue < 0);
+  }
+
+  return std::get<Backend>(value).sign();
+}
+
+Integer::Backend Integer::getBackend() const {
+  if (const auto *smallValue = std::get_if<int64_t>(&value)) {
+    return *smallValue;
+  }
+
+  return std::get<Backend>(value);
 }
 
-const Integer::Backend &Integer::getBackend() const noexcept {
-  return backend;
+const Integer::Backend *Integer::getLargeBackend() const noexcept {
+  return std::get_if<Backend>(&value);
 }
 
 bool Integer::equals(const Integer &rhs) const {
-  return backend == rhs.backend;
+  return value == rhs.value;
 }
 
 std::strong_ordering Integer::compare(const Integer &rhs) const {
-  return backend.compare(rhs.backend) <=> 0;
+  const auto *lhsSmallValue = std::get_if<int64_t>(&value);
+  const auto *rhsSmallValue = std::get_if<int64_t>(&rhs.value);
+
+  if (lhsSmallValue && rhsSmallValue) {
+    return *lhsSmallValue <=> *rhsSmallValue;
+  }
+
+  // Large values are out of the int64_t range, so their sign is enough
+  if (lhsSmallValue) {
+    return 0 <=> rhs.sign();
+  }
+
+  if (rhsSmallValue) {
+    return sign() <=> 0;
+  }
+
+  return std::get<Backend>(value).compare(std::get<Backend>(rhs.value)) <=> 0;
 }
 
 Integer &Integer::add(const Integer &rhs) {
-  backend += rhs.backend;
+  auto *lhsSmallValue = std::get_if<int64_t>(&value);
+  const auto *rhsSmallValue = std::get_if<int64_t>(&rhs.value);
+
+  if (lhsSmallValue && rhsSmallValue && tryAdd(*lhsSmallValue, *rhsSmallValue, *lhsSmallValue)) {
+    return *this;
+  }
+
+  Backend &lhsBackend = toLarge();
+  std::visit([&lhsBackend](const auto &rhsValue) { lhsBackend += rhsValue; }, rhs.value);
+  normalize();
   return *this;
 }
 
 Integer &Integer::substract(const Integer &rhs) {
-  backend -= rhs.backend;
+  auto *lhsSmallValue = std::get_if<int64_t>(&value);
+  const auto *rhsSmallValue = std::get_if<int64_t>(&rhs.value);
+
+  if (lhsSmallValue && rhsSmallValue && trySubstract(*lhsSmallValue, *rhsSmallValue, *lhsSmallValue)) {
+    return *this;
+  }
+
+  Backend &lhsBackend = toLarge();
+  std::visit([&lhsBackend](const auto &rhsValue) { lhsBackend -= rhsValue; }, rhs.value);
+  normalize();
   return *this;
 }
 
 Integer &Integer::multiply(const Integer &rhs) {
-  backend *= rhs.backend;
+  auto *lhsSmallValue = std::get_if<int64_t>(&value);
+  const auto *rhsSmallValue = std::get_if<int64_t>(&rhs.value);
+
+  if (lhsSmallValue && rhsSmallValue && tryMultiply(*lhsSmallValue, *rhsSmallValue, *lhsSmallValue)) {
+    return *this;
+  }
+
+  Backend &lhsBackend = toLarge();
+  std::visit([&lhsBackend](const auto &rhsValue) { lhsBackend *= rhsValue; }, rhs.value);
+  normalize();
   return *this;
 }
 
@@ -84,12 +208,29 @@ Integer &Integer::divide(const Integer &rhs) {
         rhs.toString()));
   }
 
-  backend /= rhs.backend;
+  auto *lhsSmallValue = std::get_if<int64_t>(&value);
+  const auto *rhsSmallValue = std::get_if<int64_t>(&rhs.value);
+
+  if (lhsSmallValue && rhsSmallValue && !(*lhsSmallValue == minSmallValue && *rhsSmallValue == -1)) {
+    *lhsSmallValue /= *rhsSmallValue;
+    return *this;
+  }
+
+  Backend &lhsBackend = toLarge();
+  std::visit([&lhsBackend](const auto &rhsValue) { lhsBackend /= rhsValue; }, rhs.value);
+  normalize();
   return *this;
 }
 
 Integer &Integer::negate() {
+  if (auto *smallValue = std::get_if<int64_t>(&value); smallValue && *smallValue != minSmallValue) {
+    *smallValue = -*smallValue;
+    return *this;
+  }
+
+  Backend &backend = toLarge();
   backend = -backend;
+  normalize();
   return *this;
 }
 
@@ -101,22 +242,63 @@ Integer &Integer::mod(const Integer &rhs) {
         rhs.toString()));
   }
 
-  backend %= rhs.backend;
+  auto *lhsSmallValue = std::get_if<int64_t>(&value);
+  const auto *rhsSmallValue = std::get_if<int64_t>(&rhs.value);
+
+  if (lhsSmallValue && rhsSmallValue) {
+    // Avoids the overflow of minSmallValue % -1
+    *lhsSmallValue = *rhsSmallValue == -1 ? 0 : *lhsSmallValue % *rhsSmallValue;
+    return *this;
+  }
+
+  Backend &lhsBackend = toLarge();
+  std::visit([&lhsBackend](const auto &rhsValue) { lhsBackend %= rhsValue; }, rhs.value);
+  normalize();
   return *this;
 }
 
 Integer &Integer::bitAnd(const Integer &rhs) {
-  backend &= rhs.backend;
+  auto *lhsSmallValue = std::get_if<int64_t>(&value);
+  const auto *rhsSmallValue = std::get_if<int64_t>(&rhs.value);
+
+  if (lhsSmallValue && rhsSmallValue) {
+    *lhsSmallValue &= *rhsSmallValue;
+    return *this;
+  }
+
+  Backend &lhsBackend = toLarge();
+  lhsBackend &= rhs.getBackend();
+  normalize();
   return *this;
 }
 
 Integer &Integer::bitOr(const Integer &rhs) {
-  backend |= rhs.backend;
+  auto *lhsSmallValue = std::get_if<int64_t>(&value);
+  const auto *rhsSmallValue = std::get_if<int64_t>(&rhs.value);
+
+  if (lhsSmallValue && rhsSmallValue) {
+    *lhsSmallValue |= *rhsSmallValue;
+    return *this;
+  }
+
+  Backend &lhsBackend = toLarge();
+  lhsBackend |= rhs.getBackend();
+  normalize();
   return *this;
 }
 
 Integer &Integer::bitXor(const Integer &rhs) {
-  backend ^= rhs.backend;
+  auto *lhsSmallValue = std::get_if<int64_t>(&value);
+  const auto *rhsSmallValue = std::get_if<int64_t>(&rhs.value);
+
+  if (lhsSmallValue && rhsSmallValue) {
+    *lhsSmallValue ^= *rhsSmallValue;
+    return *this;
+  }
+
+  Backend &lhsBackend = toLarge();
+  lhsBackend ^= rhs.getBackend();
+  normalize();
   return *this;
 }
 
@@ -128,7 +310,18 @@ Integer &Integer::bitLeftShift(const Integer &rhs) {
         rhs.toString()));
   }
 
-  backend <<= static_cast<int64_t>(rhs.backend);
+  const auto shift = static_cast<int64_t>(rhs);
+
+  if (auto *smallValue = std::get_if<int64_t>(&value);
+      smallValue && shift < maxSmallShift && (*smallValue << shift) >> shift == *smallValue) {
+
+    *smallValue <<= shift;
+    return *this;
+  }
+
+  Backend &backend = toLarge();
+  backend <<= shift;
+  normalize();
   return *this;
 }
 
@@ -140,25 +333,69 @@ Integer &Integer::bitRightShift(const Integer &rhs) {
         rhs.toString()));
   }
 
-  backend >>= static_cast<int64_t>(rhs.backend);
+  const auto shift = static_cast<int64_t>(rhs);
+
+  if (auto *smallValue = std::get_if<int64_t>(&value)) {
+    *smallValue >>= std::min(shift, maxSmallShift);
+    return *this;
+  }
+
+  Backend &backend = toLarge();
+  backend >>= shift;
+  normalize();
   return *this;
 }
 
 Integer &Integer::bitNot() {
+  if (auto *smallValue = std::get_if<int64_t>(&value)) {
+    *smallValue = ~*smallValue;
+    return *this;
+  }
+
+  Backend &backend = toLarge();
   backend = ~backend;
+  normalize();
   return *this;
 }
 
 Integer &Integer::increase() {
-  ++backend;
+  if (auto *smallValue = std::get_if<int64_t>(&value); smallValue && *smallValue != maxSmallValue) {
+    ++*smallValue;
+    return *this;
+  }
+
+  ++toLarge();
+  normalize();
   return *this;
 }
 
 Integer &Integer::decrease() {
-  --backend;
+  if (auto *smallValue = std::get_if<int64_t>(&value); smallValue && *smallValue != minSmallValue) {
+    --*smallValue;
+    return *this;
+  }
+
+  --toLarge();
+  normalize();
   return *this;
 }
 
+Integer::Backend &Integer::toLarge() {
+  if (const auto *smallValue = std::get_if<int64_t>(&value)) {
+    value = Backend(*smallValue);
+  }
+
+  return std::get<Backend>(value);
+}
+
+void Integer::normalize() {
+  if (const auto *backend = std::get_if<Backend>(&value);
+      backend && *backend >= minSmallValue && *backend <= maxSmallValue) {
+
+    value = backend->convert_to<int64_t>();
+  }
+}
+
 Integer &Integer::operator%=(const Integer &rhs) {
   return mod(rhs);
 }
@@ -1,10 +1,19 @@
 #include "fintamath/numbers/IntegerFunctions.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
 #include <utility>
+#include <variant>
 #include <vector>
 
+#include <gmp.h>
+
+#include <fmt/core.h>
+
 #include <boost/multiprecision/detail/default_ops.hpp>
 
 #include "fintamath/exceptions/UndefinedException.hpp"
@@ -14,16 +23,407 @@ using namespace boost::multiprecision;
 
 namespace fintamath {
 
+namespace {
+
+uint64_t unsignedAbs(const int64_t rhs) {
+  const auto res = static_cast<uint64_t>(rhs);
+  return rhs < 0 ? 0 - res : res;
+}
+
+// Large values are used in place, small ones are converted into the buffer
+const Integer::Backend &toBackend(const Integer &rhs, Integer::Backend &buffer) {
+  if (const Integer::Backend *largeBackend = rhs.getLargeBackend()) {
+    return *largeBackend;
+  }
+
+  buffer = rhs.getBackend();
+  return buffer;
+}
+
+// Squares of the primes below fit into 32 bits, which is the size of unsigned long on some platforms
+constexpr uint32_t smallPrimesLimit = 1U << 16;
+
+// GMP runs Baillie-PSW first and the rest of the rounds are Miller-Rabin with random bases
+constexpr int primalityTestRounds = 25;
+
+// Primes up to the max inclusive.
+// Use sieve of Eratosthenes.
+// https://en.wikipedia.org/wiki/Sieve_of_Eratosthenes.
+std::vector<uint32_t> sievePrimes(const uint32_t max) {
+  std::vector<bool> isComposite(static_cast<size_t>(max) + 1);
+  std::vector<uint32_t> res;
+
+  for (uint64_t i = 2; i <= max; i++) {
+    if (isComposite[i]) {
+      continue;
+    }
+
+    res.emplace_back(static_cast<uint32_t>(i));
+
+    for (uint64_t j = i * i; j <= max; j += i) {
+      isComposite[j] = true;
+    }
+  }
+
+  return res;
+}
+
+const std::vector<uint32_t> &getSmallPrimes() {
+  static const std::vector<uint32_t> primes = sievePrimes(smallPrimesLimit - 1);
+  return primes;
+}
+
+std::vector<uint32_t> getPrimes(const uint32_t max) {
+  if (max < smallPrimesLimit) {
+    const std::vector<uint32_t> &smallPrimes = getSmallPrimes();
+    return {smallPrimes.begin(), std::ranges::upper_bound(smallPrimes, max)};
+  }
+
+  return sievePrimes(max);
+}
+
+// Exponent of the prime in n!.
+// Use Legendre's formula.
+// https://en.wikipedia.org/wiki/Legendre%27s_formula.
+uint64_t factorialPrimeExponent(uint32_t n, const uint32_t prime) {
+  uint64_t res = 0;
+
+  while (n > 0) {
+    n /= prime;
+    res += n;
+  }
+
+  return res;
+}
+
+// Packs small factors into words and multiplies the words pairwise,
+// so that large multiplications get operands of close sizes
+class Product final {
+public:
+  void multiply(const uint64_t factor) {
+    if (word > std::numeric_limits<uint64_t>::max() / factor) {
+      words.emplace_back(word);
+      word = 1;
+    }
+
+    word *= factor;
+  }
+
+  void multiply(const uint32_t factor, uint64_t count) {
+    for (; count > 0; count--) {
+      multiply(factor);
+    }
+  }
+
+  Integer get() {
+    words.emplace_back(word);
+    word = 1;
+    return get(0, words.size());
+  }
+
+private:
+  Integer get(const size_t begin, const size_t end) const {
+    if (end - begin == 1) {
+      return words[begin];
+    }
+
+    const size_t mid = std::midpoint(begin, end);
+    return get(begin, mid) * get(mid, end);
+  }
+
+private:
+  std::vector<Integer> words;
+
+  uint64_t word = 1;
+};
+
+// Factorials of the numbers below are kept in a table
+constexpr uint32_t factorialTableSize = 256;
+
+// Binomial coefficients with the smaller argument below are computed by the multiplicative formula
+constexpr uint32_t multiplicativeBinomialLimit = 32;
+
+const std::vector<Integer> &getFactorialTable() {
+  static const std::vector<Integer> table = [] {
+    std::vector<Integer> res{1};
+
+    for (uint32_t i = 1; i < factorialTableSize; i++) {
+      res.emplace_back(res.back() * i);
+    }
+
+    return res;
+  }();
+
+  return table;
+}
+
+// Swing is n! / ((n / 2)!)^2, the exponent of a prime in it is the number of odd n / p^i,
+// so every prime power in the product is not greater than n
+Integer primeSwing(const uint32_t n, const std::vector<uint32_t> &primes) {
+  Product res;
+
+  for (const uint32_t prime : primes) {
+    if (prime > n) {
+      break;
+    }
+
+    uint64_t primePower = 1;
+
+    for (uint32_t quotient = n / prime; quotient > 0; quotient /= prime) {
+      if (quotient % 2 == 1) {
+        primePower *= prime;
+      }
+    }
+
+    res.multiply(primePower);
+  }
+
+  return res.get();
+}
+
+// Use prime swing algorithm, n! = ((n / 2)!)^2 * swing(n).
+// http://www.luschny.de/math/factorial/Benchmark.html.
+Integer factorialRec(const uint32_t n, const std::vector<uint32_t> &primes) {
+  if (n < factorialTableSize) {
+    return getFactorialTable()[n];
+  }
+
+  const Integer halfFactorial = factorialRec(n / 2, primes);
+  return halfFactorial * halfFactorial * primeSwing(n, primes);
+}
+
+// Use multiplicative formula, every partial product is a binomial coefficient itself.
+// https://en.wikipedia.org/wiki/Binomial_coefficient#Multiplicative_formula.
+Integer binomialMultiplicative(const Integer &n, const Integer &k) {
+  Integer res = 1;
+
+  for (Integer i = 1; i <= k; ++i) {
+    res = res * (n - k + i) / i;
+  }
+
+  return res;
+}
+
+// Exponents of primes are counted by Legendre's formula, so no factorials are computed
+Integer multinomialPrimeExponents(const uint32_t totalNumber, const std::vector<uint32_t> &groupNumbers) {
+  Product res;
+
+  for (const uint32_t prime : getPrimes(totalNumber)) {
+    uint64_t exponent = factorialPrimeExponent(totalNumber, prime);
+
+    for (const uint32_t groupNumber : groupNumbers) {
+      exponent -= factorialPrimeExponent(groupNumber, prime);
+    }
+
+    res.multiply(prime, exponent);
+  }
+
+  return res.get();
+}
+
+// Binomial coefficient for 0 <= k <= n
+Integer binomial(const Integer &n, Integer k) {
+  k = std::min(k, n - k);
+
+  if (k < multiplicativeBinomialLimit || n > std::numeric_limits<uint32_t>::max()) {
+    return binomialMultiplicative(n, k);
+  }
+
+  const auto nValue = static_cast<uint32_t>(n);
+  const auto kValue = static_cast<uint32_t>(k);
+
+  if (nValue < factorialTableSize) {
+    const std::vector<Integer> &table = getFactorialTable();
+    return table[nValue] / (table[kValue] * table[nValue - kValue]);
+  }
+
+  return multinomialPrimeExponents(nValue, {kValue, nValue - kValue});
+}
+
+bool isProbablePrime(const Integer::Backend &rhs) {
+  return mpz_probab_prime_p(rhs.backend().data(), primalityTestRounds) != 0;
+}
+
+void addFactor(FactorToCountMap &factorToCountMap, const Integer &factor, const Integer &count = 1) {
+  factorToCountMap[factor] += count;
+}
+
+// Divides out the primes below the limit, returns true if the rest is 1 or a prime
+bool divideSmallPrimes(Integer::Backend &rhs, const uint32_t limit, FactorToCountMap &factorToCountMap) {
+  mpz_ptr rhsData = rhs.backend().data();
+
+  for (const uint32_t prime : getSmallPrimes()) {
+    if (prime > limit) {
+      return false;
+    }
+
+    if (mpz_cmp_ui(rhsData, static_cast<unsigned long>(prime) * prime) < 0) {
+      return true;
+    }
+
+    // Remainders of division by one word are much cheaper than full divisions
+    while (mpz_tdiv_ui(rhsData, prime) == 0) {
+      addFactor(factorToCountMap, prime);
+      mpz_divexact_ui(rhsData, rhsData, prime);
+    }
+  }
+
+  return false;
+}
+
+// Returns a nontrivial factor of a composite number.
+// Use Pollard's rho algorithm with Brent's cycle detection.
+// https://en.wikipedia.org/wiki/Pollard%27s_rho_algorithm#Variants.
+Integer::Backend findFactor(const Integer::Backend &rhs) {
+  // Number of steps between gcd computations
+  constexpr size_t batchSize = 128;
+
+  for (unsigned long increment = 1;; increment++) {
+    const auto next = [&rhs, increment](const Integer::Backend &value) -> Integer::Backend {
+      return (value * value + increment) % rhs;
+    };
+
+    Integer::Backend y = 2;
+    Integer::Backend x;
+    Integer::Backend ySaved;
+    Integer::Backend product = 1;
+    Integer::Backend divisor = 1;
+
+    for (size_t cycleSize = 1; divisor == 1; cycleSize *= 2) {
+      x = y;
+
+      for (size_t i = 0; i < cycleSize; i++) {
+        y = next(y);
+      }
+
+      for (size_t step = 0; step < cycleSize && divisor == 1; step += batchSize) {
+        ySaved = y;
+
+        for (size_t i = 0; i < std::min(batchSize, cycleSize - step); i++) {
+          y = next(y);
+          product = product * abs(x - y) % rhs;
+        }
+
+        divisor = gcd(product, rhs);
+      }
+    }
+
+    // The batch skipped over the factor, so the steps are repeated one by one
+    if (divisor == rhs) {
+      do {
+        ySaved = next(ySaved);
+        divisor = gcd(abs(x - ySaved), rhs);
+      } while (divisor == 1);
+    }
+
+    if (divisor != rhs) {
+      return divisor;
+    }
+  }
+}
+
+// The degree is tried from the largest one, so the base is the smallest possible
+Integer::Backend perfectPowerBase(const Integer::Backend &rhs, unsigned long &degree) {
+  Integer::Backend base;
+
+  if (mpz_cmpabs_ui(rhs.backend().data(), 1) > 0) {
+    for (degree = msb(abs(rhs)); degree > 1; degree--) {
+      // Negative numbers are only odd powers
+      if (rhs < 0 && degree % 2 == 0) {
+        continue;
+      }
+
+      if (mpz_root(base.backend().data(), rhs.backend().data(), degree) != 0) {
+        return base;
+      }
+    }
+  }
+
+  degree = 1;
+  return rhs;
+}
+
+void addLargeFactors(const Integer::Backend &rhs, const Integer &count, FactorToCountMap &factorToCountMap) {
+  if (rhs == 1) {
+    return;
+  }
+
+  if (isProbablePrime(rhs)) {
+    addFactor(factorToCountMap, Integer(rhs), count);
+    return;
+  }
+
+  // Rho is slow for powers of large primes, so perfect powers are reduced to their roots
+  if (unsigned long degree = 1; mpz_perfect_power_p(rhs.backend().data()) != 0) {
+    const Integer::Backend base = perfectPowerBase(rhs, degree);
+    addLargeFactors(base, count * static_cast<int64_t>(degree), factorToCountMap);
+    return;
+  }
+
+  const Integer::Backend factor = findFactor(rhs);
+  addLargeFactors(factor, count, factorToCountMap);
+  addLargeFactors(rhs / factor, count, factorToCountMap);
+}
+
+}
+
+Integer pow(const Integer &lhs, const Integer &rhs) {
+  if (lhs == 0 && rhs == 0) {
+    throw UndefinedException(fmt::format(
+        R"(pow({}, {}) is undefined (zero to the power of zero))",
+        lhs.toString(),
+        rhs.toString()));
+  }
+
+  if (rhs < 0) {
+    return pow(1 / lhs, -rhs);
+  }
+
+  // Powers of 0, 1 and -1 are computed without the exponent size limit
+  if (abs(lhs) <= 1) {
+    return lhs < 0 && rhs % 2 == 0 ? -lhs : lhs;
+  }
+
+  Integer::Backend rhsBuffer;
+  const Integer::Backend &rhsBackend = toBackend(rhs, rhsBuffer);
+
+  if (mpz_fits_ulong_p(rhsBackend.backend().data()) == 0) {
+    throw UndefinedException(fmt::format(
+        R"(pow({}, {}) is undefined (exponent is too large))",
+        lhs.toString(),
+        rhs.toString()));
+  }
+
+  Integer::Backend lhsBuffer;
+  Integer::Backend res;
+  mpz_pow_ui(res.backend().data(), toBackend(lhs, lhsBuffer).backend().data(), mpz_get_ui(rhsBackend.backend().data()));
+  return Integer(std::move(res));
+}
+
 Integer abs(const Integer &rhs) {
   return rhs < 0 ? -rhs : rhs;
 }
 
 Integer gcd(const Integer &lhs, const Integer &rhs) {
-  return {gcd(lhs.getBackend(), rhs.getBackend())};
+  const auto *lhsSmallValue = std::get_if<int64_t>(&lhs.value);
+  const auto *rhsSmallValue = std::get_if<int64_t>(&rhs.value);
+
+  if (lhsSmallValue && rhsSmallValue) {
+    // Magnitudes are unsigned to handle INT64_MIN, the result may be 2^63
+    return std::gcd(unsignedAbs(*lhsSmallValue), unsignedAbs(*rhsSmallValue));
+  }
+
+  Integer::Backend lhsBuffer;
+  Integer::Backend rhsBuffer;
+  return {gcd(toBackend(lhs, lhsBuffer), toBackend(rhs, rhsBuffer))};
 }
 
 Integer lcm(const Integer &lhs, const Integer &rhs) {
-  return {lcm(lhs.getBackend(), rhs.getBackend())};
+  if (lhs == 0 || rhs == 0) {
+    return 0;
+  }
+
+  return abs(lhs / gcd(lhs, rhs) * rhs);
 }
 
 Integer sqrt(const Integer &rhs) {
@@ -38,25 +438,75 @@ Integer sqrt(const Integer &rhs, Integer &remainder) {
         rhs.toString()));
   }
 
+  Integer::Backend rhsBuffer;
   Integer::Backend remainderBackend;
-  Integer res(sqrt(rhs.getBackend(), remainderBackend));
+  Integer res(sqrt(toBackend(rhs, rhsBuffer), remainderBackend));
   remainder = Integer(std::move(remainderBackend));
   return res;
 }
 
-// Use binary splitting.
-// http://numbers.computation.free.fr/Constants/Algorithms/splitting.html.
-Integer factorialRec(const Integer &left, const Integer &right) {
-  if (left == right) {
-    return left;
+Integer root(const Integer &rhs, const Integer &degree) {
+  Integer remainder;
+  return root(rhs, degree, remainder);
+}
+
+Integer root(const Integer &rhs, const Integer &degree, Integer &remainder) {
+  if (degree < 1) {
+    throw UndefinedException(fmt::format(
+        R"(root({}, {}) is undefined (expected degree > 0))",
+        rhs.toString(),
+        degree.toString()));
   }
 
-  if (right - left == 1) {
-    return left * right;
+  if (rhs < 0 && degree % 2 == 0) {
+    throw UndefinedException(fmt::format(
+        R"(root({}, {}) is undefined (expected argument >= 0 for even degree))",
+        rhs.toString(),
+        degree.toString()));
+  }
+
+  if (rhs == 0) {
+    remainder = 0;
+    return 0;
+  }
+
+  Integer::Backend rhsBuffer;
+  const Integer::Backend &rhsBackend = toBackend(rhs, rhsBuffer);
+
+  // Roots of higher degrees are 1 in absolute value
+  if (degree > msb(abs(rhsBackend)) + 1) {
+    const Integer res = rhs.sign();
+    remainder = rhs - res;
+    return res;
+  }
+
+  Integer::Backend res;
+  Integer::Backend remainderBackend;
+  mpz_rootrem(res.backend().data(),
+              remainderBackend.backend().data(),
+              rhsBackend.backend().data(),
+              static_cast<unsigned long>(degree));
+
+  remainder = Integer(std::move(remainderBackend));
+  return Integer(std::move(res));
+}
+
+bool isPerfectPower(const Integer &rhs) {
+  Integer::Backend rhsBuffer;
+  return mpz_perfect_power_p(toBackend(rhs, rhsBuffer).backend().data()) != 0;
+}
+
+Integer perfectPowerBase(const Integer &rhs, Integer &degree) {
+  if (!isPerfectPower(rhs)) {
+    degree = 1;
+    return rhs;
   }
 
-  const Integer mid((left + right) / 2);
-  return factorialRec(left, mid) * factorialRec(mid + 1, right);
+  Integer::Backend rhsBuffer;
+  unsigned long degreeValue = 1;
+  Integer res(perfectPowerBase(toBackend(rhs, rhsBuffer), degreeValue));
+  degree = static_cast<int64_t>(degreeValue);
+  return res;
 }
 
 Integer factorial(const Integer &rhs) {
@@ -66,11 +516,19 @@ Integer factorial(const Integer &rhs) {
         rhs.toString()));
   }
 
-  if (rhs < 2) {
-    return 1;
+  if (rhs > std::numeric_limits<uint32_t>::max()) {
+    throw UndefinedException(fmt::format(
+        R"(factorial({}) is undefined (argument is too large))",
+        rhs.toString()));
+  }
+
+  const auto rhsValue = static_cast<uint32_t>(rhs);
+
+  if (rhsValue < factorialTableSize) {
+    return getFactorialTable()[rhsValue];
   }
 
-  return factorialRec(2, rhs);
+  return factorialRec(rhsValue, getPrimes(rhsValue));
 }
 
 Integer factorial(const Integer &rhs, const size_t order) {
@@ -98,7 +556,16 @@ Integer factorial(const Integer &rhs, const size_t order) {
   return res;
 }
 
-FactorToCountMap factors(Integer rhs, Integer limit) {
+bool isPrime(const Integer &rhs) {
+  if (rhs < 2) {
+    return false;
+  }
+
+  Integer::Backend rhsBuffer;
+  return isProbablePrime(toBackend(rhs, rhsBuffer));
+}
+
+FactorToCountMap factors(const Integer &rhs, const Integer &limit) {
   if (rhs < 2) {
     throw UndefinedException(fmt::format(
         R"(factors({}) is undefined (expected argument >= 2))",
@@ -106,29 +573,37 @@ FactorToCountMap factors(Integer rhs, Integer limit) {
   }
 
   FactorToCountMap factorToCountMap;
+  Integer::Backend rest = rhs.getBackend();
 
-  while (rhs % 2 == 0) {
-    ++factorToCountMap[2];
-    rhs /= 2;
-  }
-
-  {
-    const Integer rhsSqrt = sqrt(rhs);
+  const uint32_t smallPrimesMax = limit < 0 || limit >= smallPrimesLimit
+                                      ? smallPrimesLimit
+                                      : static_cast<uint32_t>(limit);
 
-    if (limit < 0 || limit > rhsSqrt) {
-      limit = rhsSqrt;
+  if (divideSmallPrimes(rest, smallPrimesMax, factorToCountMap)) {
+    if (rest > 1) {
+      addFactor(factorToCountMap, Integer(rest));
     }
+
+    return factorToCountMap;
   }
 
-  for (Integer i = 3; i <= limit; i += 2) {
-    while (rhs % i == 0) {
-      ++factorToCountMap[i];
-      rhs = rhs / i;
+  if (limit < 0) {
+    addLargeFactors(rest, 1, factorToCountMap);
+    return factorToCountMap;
+  }
+
+  Integer::Backend limitBuffer;
+  const Integer::Backend &limitBackend = toBackend(limit, limitBuffer);
+
+  for (Integer::Backend i = smallPrimesLimit + 1; i <= limitBackend && i * i <= rest; i += 2) {
+    while (rest % i == 0) {
+      addFactor(factorToCountMap, Integer(i));
+      rest /= i;
     }
   }
 
-  if (rhs > 1) {
-    ++factorToCountMap[rhs];
+  if (rest > 1) {
+    addFactor(factorToCountMap, Integer(rest));
   }
 
   return factorToCountMap;
@@ -144,15 +619,14 @@ Integer combinations(const Integer &totalNumber, const Integer &choosedNumber) {
         choosedNumber.toString()));
   }
 
-  try {
-    return factorial(totalNumber) / (factorial(choosedNumber) * factorial(totalNumber - choosedNumber));
-  }
-  catch (const UndefinedException &) {
+  if (choosedNumber < 0) {
     throw UndefinedException(fmt::format(
         R"(combinations({}, {}) is undefined (expected totalNumber >= 0 and choosedNumber >= 0))",
         totalNumber.toString(),
         choosedNumber.toString()));
   }
+
+  return binomial(totalNumber, choosedNumber);
 }
 
 // Use multinomial coefficients formula.
@@ -160,15 +634,47 @@ Integer combinations(const Integer &totalNumber, const Integer &choosedNumber) {
 Integer multinomialCoefficient(const std::vector<Integer> &groupNumbers) {
   Integer totalNumber;
   for (const auto &groupNumber : groupNumbers) {
+    if (groupNumber < 0) {
+      throw UndefinedException(fmt::format(
+          R"(multinomialCoefficient is undefined (expected group numbers >= 0, got {}))",
+          groupNumber.toString()));
+    }
+
     totalNumber += groupNumber;
   }
 
-  Integer res = factorial(totalNumber);
+  // The coefficient is a product of binomial coefficients of the partial sums
+  if (totalNumber > std::numeric_limits<uint32_t>::max()) {
+    Integer res = 1;
+    Integer partialSum = 0;
+
+    for (const auto &groupNumber : groupNumbers) {
+      partialSum += groupNumber;
+      res *= binomial(partialSum, groupNumber);
+    }
+
+    return res;
+  }
+
+  const auto totalNumberValue = static_cast<uint32_t>(totalNumber);
+
+  if (totalNumberValue < factorialTableSize) {
+    const std::vector<Integer> &table = getFactorialTable();
+
+    Integer res = table[totalNumberValue];
+    for (const auto &groupNumber : groupNumbers) {
+      res /= table[static_cast<uint32_t>(groupNumber)];
+    }
+
+    return res;
+  }
+
+  std::vector<uint32_t> groupNumberValues;
   for (const auto &groupNumber : groupNumbers) {
-    res /= factorial(groupNumber);
+    groupNumberValues.emplace_back(static_cast<uint32_t>(groupNumber));
   }
 
-  return res;
+  return multinomialPrimeExponents(totalNumberValue, groupNumberValues);
 }
 
 }
@@ -126,32 +126,69 @@ bool Rational::equals(const Rational &rhs) const {
 }
 
 std::strong_ordering Rational::compare(const Rational &rhs) const {
-  Rational lhs = *this;
-  Rational tmpRhs = rhs;
-  toCommonDenominators(lhs, tmpRhs);
-  return lhs.numer <=> tmpRhs.numer;
+  // Denominators are always positive
+  if (denom == rhs.denom) {
+    return numer <=> rhs.numer;
+  }
+
+  return numer * rhs.denom <=> rhs.numer * denom;
 }
 
 Rational &Rational::add(const Rational &rhs) {
-  Rational tmpRhs = rhs;
-  toCommonDenominators(*this, tmpRhs);
-  numer += tmpRhs.numer;
-  toIrreducibleRational();
+  if (denom == rhs.denom) {
+    numer += rhs.numer;
+
+    if (denom != 1) {
+      toIrreducibleRational();
+    }
+
+    return *this;
+  }
+
+  // Reduced operands only need gcds of the denominators, see Knuth TAOCP 4.5.1
+  const Integer denomsGcd = gcd(denom, rhs.denom);
+
+  if (denomsGcd == 1) {
+    numer = numer * rhs.denom + rhs.numer * denom;
+    denom *= rhs.denom;
+    return *this;
+  }
+
+  const Integer lhsDenomPart = denom / denomsGcd;
+  numer = numer * (rhs.denom / denomsGcd) + rhs.numer * lhsDenomPart;
+
+  if (numer == 0) {
+    denom = 1;
+    return *this;
+  }
+
+  const Integer resGcd = gcd(numer, denomsGcd);
+  numer /= resGcd;
+  denom = lhsDenomPart * (rhs.denom / resGcd);
   return *this;
 }
 
 Rational &Rational::substract(const Rational &rhs) {
-  Rational tmpRhs = rhs;
-  toCommonDenominators(*this, tmpRhs);
-  numer -= tmpRhs.numer;
-  toIrreducibleRational();
-  return *this;
+  return add(-rhs);
 }
 
 Rational &Rational::multiply(const Rational &rhs) {
-  numer *= rhs.numer;
-  denom *= rhs.denom;
-  toIrreducibleRational();
+  if (denom == 1 && rhs.denom == 1) {
+    numer *= rhs.numer;
+    return *this;
+  }
+
+  if (numer == 0 || rhs.numer == 0) {
+    numer = 0;
+    denom = 1;
+    return *this;
+  }
+
+  // Cross gcds keep the product reduced, see Knuth TAOCP 4.5.1
+  const Integer lhsGcd = gcd(numer, rhs.denom);
+  const Integer rhsGcd = gcd(rhs.numer, denom);
+  numer = (numer / lhsGcd) * (rhs.numer / rhsGcd);
+  denom = (denom / rhsGcd) * (rhs.denom / lhsGcd);
   return *this;
 }
 
@@ -163,10 +200,16 @@ Rational &Rational::divide(const Rational &rhs) {
         rhs.toString()));
   }
 
-  numer *= rhs.denom;
-  denom *= rhs.numer;
-  toIrreducibleRational();
-  return *this;
+  Rational inverted;
+  inverted.numer = rhs.denom;
+  inverted.denom = rhs.numer;
+
+  if (inverted.denom < 0) {
+    inverted.numer = -inverted.numer;
+    inverted.denom = -inverted.denom;
+  }
+
+  return multiply(inverted);
 }
 
 Rational &Rational::negate() {
@@ -185,14 +228,44 @@ void Rational::toIrreducibleRational() {
   denom /= gcdVal;
 }
 
-void Rational::toCommonDenominators(Rational &lhs, Rational &rhs) {
-  const Integer lcmVal = lcm(lhs.denom, rhs.denom);
+namespace detail {
+
+RationalAccumulator &RationalAccumulator::operator+=(const Rational &rhs) {
+  add(rhs.numerator(), rhs.denominator());
+  return *this;
+}
+
+void RationalAccumulator::addProduct(const Rational &lhs, const Rational &rhs) {
+  if (lhs.denominator() == 1 && rhs.denominator() == 1) {
+    add(lhs.numerator() * rhs.numerator(), 1);
+    return;
+  }
+
+  add(lhs.numerator() * rhs.numerator(), lhs.denominator() * rhs.denominator());
+}
 
-  lhs.numer *= (lcmVal / lhs.denom);
-  lhs.denom = lcmVal;
+bool RationalAccumulator::isZero() const {
+  return numer == 0;
+}
+
+Rational RationalAccumulator::toRational() const {
+  if (denom == 1) {
+    return numer;
+  }
+
+  return Rational(numer, denom);
+}
+
+void RationalAccumulator::add(const Integer &rhsNumer, const Integer &rhsDenom) {
+  if (denom == rhsDenom) {
+    numer += rhsNumer;
+    return;
+  }
+
+  numer = numer * rhsDenom + rhsNumer * denom;
+  denom *= rhsDenom;
+}
 
-  rhs.numer *= (lcmVal / rhs.denom);
-  rhs.denom = lcmVal;
 }
 
 }
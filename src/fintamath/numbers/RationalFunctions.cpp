@@ -1,5 +1,11 @@
 #include "fintamath/numbers/RationalFunctions.hpp"
 
+#include <optional>
+#include <utility>
+
+#include <fmt/core.h>
+
+#include "fintamath/exceptions/UndefinedException.hpp"
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/IntegerFunctions.hpp"
 #include "fintamath/numbers/Rational.hpp"
@@ -30,4 +36,39 @@ Rational abs(const Rational &rhs) {
   return rhs < 0 ? -rhs : rhs;
 }
 
+Rational pow(const Rational &lhs, const Integer &rhs) {
+  if (lhs == 0 && rhs == 0) {
+    throw UndefinedException(fmt::format(
+        R"(pow({}, {}) is undefined (zero to the power of zero))",
+        lhs.toString(),
+        rhs.toString()));
+  }
+
+  if (rhs < 0) {
+    return pow(1 / lhs, -rhs);
+  }
+
+  // Powers of coprime numbers are coprime, so the result is already reduced
+  Rational res;
+  res.numer = pow(lhs.numerator(), rhs);
+  res.denom = pow(lhs.denominator(), rhs);
+  return res;
+}
+
+std::optional<Rational> perfectRoot(const Rational &rhs, const Integer &degree) {
+  Integer remainder;
+
+  Integer numerator = root(rhs.numerator(), degree, remainder);
+  if (remainder != 0) {
+    return {};
+  }
+
+  Integer denominator = root(rhs.denominator(), degree, remainder);
+  if (remainder != 0) {
+    return {};
+  }
+
+  return Rational(std::move(numerator), std::move(denominator));
+}
+
 }
@@ -173,6 +173,14 @@ void Real::setPrecisionStatic(unsigned precision) {
   Backend::thread_default_precision(precision * precisionMultiplier + precisionDelta);
 }
 
+void Real::setDefaultPrecisionStatic(unsigned precision) {
+  if (precision == 0) {
+    precision++;
+  }
+
+  Backend::default_precision(precision * precisionMultiplier + precisionDelta);
+}
+
 bool Real::equals(const Real &rhs) const {
   return backend == rhs.backend && sign() == rhs.sign();
 }
@@ -0,0 +1,302 @@
+#include "fintamath/numbers/RealBall.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <compare>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/mpfr.hpp>
+
+#include <fmt/core.h>
+
+#include "fintamath/exceptions/InvalidInputException.hpp"
+#include "fintamath/exceptions/UndefinedException.hpp"
+#include "fintamath/numbers/Integer.hpp"
+#include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/Real.hpp"
+
+namespace fintamath {
+
+FINTAMATH_CLASS_IMPLEMENTATION(RealBall)
+
+using Backend = RealBall::Backend;
+
+namespace {
+
+// Radii only bound errors, so a few digits are enough for them
+constexpr unsigned radiusPrecision = 20;
+
+constexpr unsigned radiusOutputPrecision = 3;
+
+mpfr_ptr data(Backend &rhs) {
+  return rhs.backend().data();
+}
+
+mpfr_srcptr data(const Backend &rhs) {
+  return rhs.backend().data();
+}
+
+Backend makeRadius() {
+  return Backend(0, radiusPrecision);
+}
+
+// Adds one ulp of the value at its precision
+void addUlp(Backend &radius, const Backend &value) {
+  Backend ulp = makeRadius();
+
+  if (mpfr_zero_p(data(value))) {
+    mpfr_nextabove(data(ulp));
+  }
+  else {
+    mpfr_set_ui_2exp(data(ulp), 1, mpfr_get_exp(data(value)) - mpfr_get_prec(data(value)), MPFR_RNDU);
+  }
+
+  mpfr_add(data(radius), data(radius), data(ulp), MPFR_RNDU);
+}
+
+// Adds one ulp of the value if it was rounded
+void addRoundingError(Backend &radius, const Backend &value, const int ternary) {
+  if (ternary != 0) {
+    addUlp(radius, value);
+  }
+}
+
+// Upper bound of |lhs| * rhs, rhs is not negative
+void addAbsProduct(Backend &res, const Backend &lhs, const Backend &rhs) {
+  Backend prod = makeRadius();
+  mpfr_mul(data(prod), data(lhs), data(rhs), MPFR_RNDA);
+  mpfr_abs(data(prod), data(prod), MPFR_RNDU);
+  mpfr_add(data(res), data(res), data(prod), MPFR_RNDU);
+}
+
+void checkFinite(const Backend &midpoint, const Backend &radius) {
+  if (!mpfr_number_p(data(midpoint)) || !mpfr_number_p(data(radius))) {
+    throw UndefinedException(fmt::format(
+        R"(Undefined {} (overflow))",
+        RealBall::getClassStatic()->getName()));
+  }
+}
+
+}
+
+RealBall::RealBall() : radius(makeRadius()) {
+}
+
+RealBall::RealBall(const Integer &rhs) : radius(makeRadius()) {
+  const int ternary = mpfr_set_z(data(midpoint), rhs.getBackend().backend().data(), MPFR_RNDN);
+  addRoundingError(radius, midpoint, ternary);
+}
+
+RealBall::RealBall(const Rational &rhs) : radius(makeRadius()) {
+  const boost::multiprecision::mpq_rational rational(rhs.numerator().getBackend(), rhs.denominator().getBackend());
+  const int ternary = mpfr_set_q(data(midpoint), rational.backend().data(), MPFR_RNDN);
+  addRoundingError(radius, midpoint, ternary);
+}
+
+// Real is a result of rounding to its precision, the exact value is unknown
+RealBall::RealBall(const Real &rhs) : midpoint(rhs.getBackend()), radius(makeRadius()) {
+  addUlp(radius, midpoint);
+}
+
+RealBall::RealBall(const Real &inMidpoint, const Real &inRadius) : midpoint(inMidpoint.getBackend()), radius(makeRadius()) {
+  if (inRadius < 0) {
+    throw InvalidInputException(fmt::format(
+        R"(Unable to construct {} with negative radius {})",
+        getClassStatic()->getName(),
+        inRadius.toString()));
+  }
+
+  mpfr_set(data(radius), data(inRadius.getBackend()), MPFR_RNDU);
+}
+
+RealBall RealBall::fromBounds(const Backend &lower, const Backend &upper) {
+  if (lower > upper) {
+    throw InvalidInputException(fmt::format(
+        R"(Unable to construct {} with lower bound greater than upper bound)",
+        getClassStatic()->getName()));
+  }
+
+  RealBall res;
+
+  mpfr_add(data(res.midpoint), data(lower), data(upper), MPFR_RNDN);
+  mpfr_div_2ui(data(res.midpoint), data(res.midpoint), 1, MPFR_RNDN);
+
+  // Distances to the actual midpoint cover its rounding
+  Backend lowerDist = makeRadius();
+  mpfr_sub(data(lowerDist), data(res.midpoint), data(lower), MPFR_RNDU);
+  mpfr_sub(data(res.radius), data(upper), data(res.midpoint), MPFR_RNDU);
+  mpfr_max(data(res.radius), data(res.radius), data(lowerDist), MPFR_RNDU);
+
+  checkFinite(res.midpoint, res.radius);
+  return res;
+}
+
+std::string RealBall::toString() const {
+  const unsigned precision = std::clamp(*getPrecision(), 1U, Real::getPrecisionStatic());
+  std::string midpointStr = Real(midpoint).toString(precision);
+
+  if (mpfr_zero_p(data(radius))) {
+    return midpointStr;
+  }
+
+  const std::string radiusStr = Real(radius).toString(std::min(radiusOutputPrecision, Real::getPrecisionStatic()));
+  return fmt::format("[{} +/- {}]", midpointStr, radiusStr);
+}
+
+std::optional<unsigned> RealBall::getPrecision() const noexcept {
+  constexpr double log10Of2 = 0.30102999566398120;
+
+  const auto maxPrecision = static_cast<unsigned>(static_cast<double>(mpfr_get_prec(data(midpoint))) * log10Of2);
+
+  if (mpfr_zero_p(data(radius))) {
+    return maxPrecision;
+  }
+
+  if (mpfr_zero_p(data(midpoint))) {
+    return 0;
+  }
+
+  // |midpoint| >= 2^(exp - 1) and radius < 2^radiusExp
+  const auto bitsDiff = mpfr_get_exp(data(midpoint)) - 1 - mpfr_get_exp(data(radius));
+
+  if (bitsDiff <= 0) {
+    return 0;
+  }
+
+  return std::min(static_cast<unsigned>(static_cast<double>(bitsDiff) * log10Of2), maxPrecision);
+}
+
+int RealBall::sign() const {
+  if (containsZero()) {
+    return 0;
+  }
+
+  return mpfr_sgn(data(midpoint));
+}
+
+bool RealBall::contains(const Real &rhs) const {
+  return getLower() <= rhs.getBackend() && rhs.getBackend() <= getUpper();
+}
+
+bool RealBall::containsZero() const {
+  return mpfr_cmpabs(data(midpoint), data(radius)) <= 0;
+}
+
+const Backend &RealBall::getMidpoint() const noexcept {
+  return midpoint;
+}
+
+const Backend &RealBall::getRadius() const noexcept {
+  return radius;
+}
+
+Backend RealBall::getLower() const {
+  Backend res;
+  mpfr_sub(data(res), data(midpoint), data(radius), MPFR_RNDD);
+  return res;
+}
+
+Backend RealBall::getUpper() const {
+  Backend res;
+  mpfr_add(data(res), data(midpoint), data(radius), MPFR_RNDU);
+  return res;
+}
+
+bool RealBall::equals(const RealBall &rhs) const {
+  return midpoint == rhs.midpoint && radius == rhs.radius;
+}
+
+std::strong_ordering RealBall::compare(const RealBall &rhs) const {
+  if (midpoint != rhs.midpoint) {
+    return midpoint.compare(rhs.midpoint) <=> 0;
+  }
+
+  return radius.compare(rhs.radius) <=> 0;
+}
+
+RealBall &RealBall::add(const RealBall &rhs) {
+  Backend res;
+  const int ternary = mpfr_add(data(res), data(midpoint), data(rhs.midpoint), MPFR_RNDN);
+
+  mpfr_add(data(radius), data(radius), data(rhs.radius), MPFR_RNDU);
+  addRoundingError(radius, res, ternary);
+  midpoint = std::move(res);
+
+  checkFinite(midpoint, radius);
+  return *this;
+}
+
+RealBall &RealBall::substract(const RealBall &rhs) {
+  Backend res;
+  const int ternary = mpfr_sub(data(res), data(midpoint), data(rhs.midpoint), MPFR_RNDN);
+
+  mpfr_add(data(radius), data(radius), data(rhs.radius), MPFR_RNDU);
+  addRoundingError(radius, res, ternary);
+  midpoint = std::move(res);
+
+  checkFinite(midpoint, radius);
+  return *this;
+}
+
+// |xy - ab| <= |a| ry + |b| rx + rx ry
+RealBall &RealBall::multiply(const RealBall &rhs) {
+  Backend res;
+  const int ternary = mpfr_mul(data(res), data(midpoint), data(rhs.midpoint), MPFR_RNDN);
+
+  Backend resRadius = makeRadius();
+  addAbsProduct(resRadius, midpoint, rhs.radius);
+  addAbsProduct(resRadius, rhs.midpoint, radius);
+  addAbsProduct(resRadius, radius, rhs.radius);
+  addRoundingError(resRadius, res, ternary);
+
+  midpoint = std::move(res);
+  radius = std::move(resRadius);
+
+  checkFinite(midpoint, radius);
+  return *this;
+}
+
+// |x/y - a/b| <= (|a| ry + |b| rx) / (|b| (|b| - ry))
+RealBall &RealBall::divide(const RealBall &rhs) {
+  Backend rhsLowerAbs = makeRadius();
+  Backend rhsMidpointAbs = makeRadius();
+
+  if (!rhs.containsZero()) {
+    mpfr_set(data(rhsMidpointAbs), data(rhs.midpoint), MPFR_RNDZ);
+    mpfr_abs(data(rhsMidpointAbs), data(rhsMidpointAbs), MPFR_RNDZ);
+    mpfr_sub(data(rhsLowerAbs), data(rhsMidpointAbs), data(rhs.radius), MPFR_RNDD);
+  }
+
+  if (mpfr_sgn(data(rhsLowerAbs)) <= 0) {
+    throw UndefinedException(fmt::format(
+        R"(div({}, {}) is undefined (division by zero))",
+        toString(),
+        rhs.toString()));
+  }
+
+  Backend res;
+  const int ternary = mpfr_div(data(res), data(midpoint), data(rhs.midpoint), MPFR_RNDN);
+
+  Backend resRadius = makeRadius();
+  addAbsProduct(resRadius, midpoint, rhs.radius);
+  addAbsProduct(resRadius, rhs.midpoint, radius);
+  mpfr_mul(data(rhsLowerAbs), data(rhsLowerAbs), data(rhsMidpointAbs), MPFR_RNDD);
+  mpfr_div(data(resRadius), data(resRadius), data(rhsLowerAbs), MPFR_RNDU);
+  addRoundingError(resRadius, res, ternary);
+
+  midpoint = std::move(res);
+  radius = std::move(resRadius);
+
+  checkFinite(midpoint, radius);
+  return *this;
+}
+
+RealBall &RealBall::negate() {
+  mpfr_neg(data(midpoint), data(midpoint), MPFR_RNDN);
+  return *this;
+}
+
+}
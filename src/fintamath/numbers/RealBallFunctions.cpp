@@ -0,0 +1,548 @@
+#include "fintamath/numbers/RealBallFunctions.hpp"
+
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/mpfr.hpp>
+
+#include <fmt/core.h>
+
+#include "fintamath/exceptions/UndefinedException.hpp"
+#include "fintamath/numbers/Integer.hpp"
+#include "fintamath/numbers/RealBall.hpp"
+
+namespace fintamath {
+
+using namespace detail;
+
+using Backend = RealBall::Backend;
+
+namespace {
+
+using MpfrFunction = int (*)(mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+
+mpfr_ptr data(Backend &rhs) {
+  return rhs.backend().data();
+}
+
+mpfr_srcptr data(const Backend &rhs) {
+  return rhs.backend().data();
+}
+
+std::optional<RealBall> makeBall(const Backend &lower, const Backend &upper) {
+  if (!mpfr_number_p(data(lower)) || !mpfr_number_p(data(upper))) {
+    return {};
+  }
+
+  return RealBall::fromBounds(lower, upper);
+}
+
+std::optional<RealBall> applyIncreasing(const RealBall &rhs, const MpfrFunction func) {
+  Backend lower;
+  Backend upper;
+  func(data(lower), data(rhs.getLower()), MPFR_RNDD);
+  func(data(upper), data(rhs.getUpper()), MPFR_RNDU);
+  return makeBall(lower, upper);
+}
+
+std::optional<RealBall> applyDecreasing(const RealBall &rhs, const MpfrFunction func) {
+  Backend lower;
+  Backend upper;
+  func(data(lower), data(rhs.getUpper()), MPFR_RNDD);
+  func(data(upper), data(rhs.getLower()), MPFR_RNDU);
+  return makeBall(lower, upper);
+}
+
+// |f(x) - f(a)| <= |x - a| for functions with |f'| <= 1
+std::optional<RealBall> applyLipschitz(const RealBall &rhs, const MpfrFunction func) {
+  Backend lower;
+  Backend upper;
+  func(data(lower), data(rhs.getMidpoint()), MPFR_RNDD);
+  func(data(upper), data(rhs.getMidpoint()), MPFR_RNDU);
+  mpfr_sub(data(lower), data(lower), data(rhs.getRadius()), MPFR_RNDD);
+  mpfr_add(data(upper), data(upper), data(rhs.getRadius()), MPFR_RNDU);
+  return makeBall(lower, upper);
+}
+
+std::optional<RealBall> tryMultiply(const RealBall &lhs, const RealBall &rhs) {
+  try {
+    return lhs * rhs;
+  }
+  catch (const UndefinedException &) {
+    return {};
+  }
+}
+
+std::optional<RealBall> tryDivide(const RealBall &lhs, const RealBall &rhs) {
+  if (rhs.containsZero()) {
+    return {};
+  }
+
+  try {
+    return lhs / rhs;
+  }
+  catch (const UndefinedException &) {
+    return {};
+  }
+}
+
+std::optional<RealBall> tryDivide(const std::optional<RealBall> &lhs, const std::optional<RealBall> &rhs) {
+  if (!lhs || !rhs) {
+    return {};
+  }
+
+  return tryDivide(*lhs, *rhs);
+}
+
+std::optional<RealBall> tryInverse(const std::optional<RealBall> &rhs) {
+  return tryDivide(RealBall(1), rhs);
+}
+
+std::optional<RealBall> tryPowInteger(const RealBall &lhs, const long rhs) {
+  if (rhs == 0) {
+    if (lhs.containsZero()) {
+      return {};
+    }
+
+    return RealBall(1);
+  }
+
+  unsigned long exponent = rhs < 0 ? 0UL - static_cast<unsigned long>(rhs) : static_cast<unsigned long>(rhs);
+  std::optional<RealBall> res = RealBall(1);
+  std::optional<RealBall> square = lhs;
+
+  while (res && square) {
+    if (exponent & 1) {
+      res = tryMultiply(*res, *square);
+    }
+
+    exponent >>= 1;
+
+    if (exponent == 0) {
+      break;
+    }
+
+    square = tryMultiply(*square, *square);
+  }
+
+  if (!res || !square) {
+    return {};
+  }
+
+  return rhs < 0 ? tryInverse(res) : res;
+}
+
+bool isLowerGreater(const RealBall &rhs, const long bound) {
+  return mpfr_cmp_si(data(rhs.getLower()), bound) > 0;
+}
+
+bool isLowerGreaterOrEqual(const RealBall &rhs, const long bound) {
+  return mpfr_cmp_si(data(rhs.getLower()), bound) >= 0;
+}
+
+bool isUpperLess(const RealBall &rhs, const long bound) {
+  return mpfr_cmp_si(data(rhs.getUpper()), bound) < 0;
+}
+
+bool isUpperLessOrEqual(const RealBall &rhs, const long bound) {
+  return mpfr_cmp_si(data(rhs.getUpper()), bound) <= 0;
+}
+
+template <typename Res>
+Res valueOrThrow(std::optional<Res> res, const std::string_view funcName, const RealBall &rhs) {
+  if (!res) {
+    throw UndefinedException(fmt::format(
+        "{}({}) is undefined",
+        funcName,
+        rhs.toString()));
+  }
+
+  return std::move(*res);
+}
+
+}
+
+Integer floor(const RealBall &rhs) {
+  return valueOrThrow(tryFloor(rhs), "floor", rhs);
+}
+
+Integer ceil(const RealBall &rhs) {
+  return valueOrThrow(tryCeil(rhs), "ceil", rhs);
+}
+
+RealBall abs(const RealBall &rhs) {
+  if (!rhs.containsZero()) {
+    return rhs.sign() < 0 ? -rhs : rhs;
+  }
+
+  Backend upper = max(abs(rhs.getLower()), abs(rhs.getUpper()));
+  return RealBall::fromBounds(Backend(0), upper);
+}
+
+RealBall sqrt(const RealBall &rhs) {
+  return valueOrThrow(trySqrt(rhs), "sqrt", rhs);
+}
+
+RealBall pow(const RealBall &lhs, const RealBall &rhs) {
+  if (auto res = tryPow(lhs, rhs)) {
+    return std::move(*res);
+  }
+
+  throw UndefinedException(fmt::format(
+      "pow({}, {}) is undefined",
+      lhs.toString(),
+      rhs.toString()));
+}
+
+RealBall exp(const RealBall &rhs) {
+  return valueOrThrow(tryExp(rhs), "exp", rhs);
+}
+
+RealBall log(const RealBall &lhs, const RealBall &rhs) {
+  if (auto res = tryLog(lhs, rhs)) {
+    return std::move(*res);
+  }
+
+  throw UndefinedException(fmt::format(
+      "log({}, {}) is undefined",
+      lhs.toString(),
+      rhs.toString()));
+}
+
+RealBall ln(const RealBall &rhs) {
+  return valueOrThrow(tryLn(rhs), "ln", rhs);
+}
+
+RealBall lb(const RealBall &rhs) {
+  return valueOrThrow(tryLb(rhs), "lb", rhs);
+}
+
+RealBall lg(const RealBall &rhs) {
+  return valueOrThrow(tryLg(rhs), "lg", rhs);
+}
+
+RealBall sin(const RealBall &rhs) {
+  return valueOrThrow(trySin(rhs), "sin", rhs);
+}
+
+RealBall cos(const RealBall &rhs) {
+  return valueOrThrow(tryCos(rhs), "cos", rhs);
+}
+
+RealBall tan(const RealBall &rhs) {
+  return valueOrThrow(tryTan(rhs), "tan", rhs);
+}
+
+RealBall cot(const RealBall &rhs) {
+  return valueOrThrow(tryCot(rhs), "cot", rhs);
+}
+
+RealBall sec(const RealBall &rhs) {
+  return valueOrThrow(trySec(rhs), "sec", rhs);
+}
+
+RealBall csc(const RealBall &rhs) {
+  return valueOrThrow(tryCsc(rhs), "csc", rhs);
+}
+
+RealBall asin(const RealBall &rhs) {
+  return valueOrThrow(tryAsin(rhs), "asin", rhs);
+}
+
+RealBall acos(const RealBall &rhs) {
+  return valueOrThrow(tryAcos(rhs), "acos", rhs);
+}
+
+RealBall atan(const RealBall &rhs) {
+  return valueOrThrow(tryAtan(rhs), "atan", rhs);
+}
+
+RealBall acot(const RealBall &rhs) {
+  return valueOrThrow(tryAcot(rhs), "acot", rhs);
+}
+
+RealBall asec(const RealBall &rhs) {
+  return valueOrThrow(tryAsec(rhs), "asec", rhs);
+}
+
+RealBall acsc(const RealBall &rhs) {
+  return valueOrThrow(tryAcsc(rhs), "acsc", rhs);
+}
+
+RealBall sinh(const RealBall &rhs) {
+  return valueOrThrow(trySinh(rhs), "sinh", rhs);
+}
+
+RealBall cosh(const RealBall &rhs) {
+  return valueOrThrow(tryCosh(rhs), "cosh", rhs);
+}
+
+RealBall tanh(const RealBall &rhs) {
+  return valueOrThrow(tryTanh(rhs), "tanh", rhs);
+}
+
+RealBall coth(const RealBall &rhs) {
+  return valueOrThrow(tryCoth(rhs), "coth", rhs);
+}
+
+RealBall sech(const RealBall &rhs) {
+  return valueOrThrow(trySech(rhs), "sech", rhs);
+}
+
+RealBall csch(const RealBall &rhs) {
+  return valueOrThrow(tryCsch(rhs), "csch", rhs);
+}
+
+RealBall asinh(const RealBall &rhs) {
+  return valueOrThrow(tryAsinh(rhs), "asinh", rhs);
+}
+
+RealBall acosh(const RealBall &rhs) {
+  return valueOrThrow(tryAcosh(rhs), "acosh", rhs);
+}
+
+RealBall atanh(const RealBall &rhs) {
+  return valueOrThrow(tryAtanh(rhs), "atanh", rhs);
+}
+
+RealBall acoth(const RealBall &rhs) {
+  return valueOrThrow(tryAcoth(rhs), "acoth", rhs);
+}
+
+RealBall asech(const RealBall &rhs) {
+  return valueOrThrow(tryAsech(rhs), "asech", rhs);
+}
+
+RealBall acsch(const RealBall &rhs) {
+  return valueOrThrow(tryAcsch(rhs), "acsch", rhs);
+}
+
+namespace detail {
+
+std::optional<Integer> tryFloor(const RealBall &rhs) {
+  Integer::Backend lower;
+  Integer::Backend upper;
+  mpfr_get_z(lower.backend().data(), data(rhs.getLower()), MPFR_RNDD);
+  mpfr_get_z(upper.backend().data(), data(rhs.getUpper()), MPFR_RNDD);
+
+  if (lower != upper) {
+    return {};
+  }
+
+  return Integer(std::move(lower));
+}
+
+std::optional<Integer> tryCeil(const RealBall &rhs) {
+  Integer::Backend lower;
+  Integer::Backend upper;
+  mpfr_get_z(lower.backend().data(), data(rhs.getLower()), MPFR_RNDU);
+  mpfr_get_z(upper.backend().data(), data(rhs.getUpper()), MPFR_RNDU);
+
+  if (lower != upper) {
+    return {};
+  }
+
+  return Integer(std::move(lower));
+}
+
+std::optional<RealBall> trySqrt(const RealBall &rhs) {
+  if (!isLowerGreaterOrEqual(rhs, 0)) {
+    return {};
+  }
+
+  return applyIncreasing(rhs, mpfr_sqrt);
+}
+
+std::optional<RealBall> tryPow(const RealBall &lhs, const RealBall &rhs) {
+  const Backend &exponent = rhs.getMidpoint();
+
+  if (mpfr_zero_p(data(rhs.getRadius())) &&
+      mpfr_integer_p(data(exponent)) &&
+      mpfr_fits_slong_p(data(exponent), MPFR_RNDN)) {
+
+    return tryPowInteger(lhs, mpfr_get_si(data(exponent), MPFR_RNDN));
+  }
+
+  const std::optional<RealBall> lnLhs = tryLn(lhs);
+
+  if (!lnLhs) {
+    return {};
+  }
+
+  const std::optional<RealBall> powerOfE = tryMultiply(*lnLhs, rhs);
+
+  if (!powerOfE) {
+    return {};
+  }
+
+  return tryExp(*powerOfE);
+}
+
+std::optional<RealBall> tryExp(const RealBall &rhs) {
+  return applyIncreasing(rhs, mpfr_exp);
+}
+
+std::optional<RealBall> tryLog(const RealBall &lhs, const RealBall &rhs) {
+  return tryDivide(tryLn(rhs), tryLn(lhs));
+}
+
+std::optional<RealBall> tryLn(const RealBall &rhs) {
+  if (!isLowerGreater(rhs, 0)) {
+    return {};
+  }
+
+  return applyIncreasing(rhs, mpfr_log);
+}
+
+std::optional<RealBall> tryLb(const RealBall &rhs) {
+  if (!isLowerGreater(rhs, 0)) {
+    return {};
+  }
+
+  return applyIncreasing(rhs, mpfr_log2);
+}
+
+std::optional<RealBall> tryLg(const RealBall &rhs) {
+  if (!isLowerGreater(rhs, 0)) {
+    return {};
+  }
+
+  return applyIncreasing(rhs, mpfr_log10);
+}
+
+std::optional<RealBall> trySin(const RealBall &rhs) {
+  return applyLipschitz(rhs, mpfr_sin);
+}
+
+std::optional<RealBall> tryCos(const RealBall &rhs) {
+  return applyLipschitz(rhs, mpfr_cos);
+}
+
+std::optional<RealBall> tryTan(const RealBall &rhs) {
+  return tryDivide(trySin(rhs), tryCos(rhs));
+}
+
+std::optional<RealBall> tryCot(const RealBall &rhs) {
+  return tryDivide(tryCos(rhs), trySin(rhs));
+}
+
+std::optional<RealBall> trySec(const RealBall &rhs) {
+  return tryInverse(tryCos(rhs));
+}
+
+std::optional<RealBall> tryCsc(const RealBall &rhs) {
+  return tryInverse(trySin(rhs));
+}
+
+std::optional<RealBall> tryAsin(const RealBall &rhs) {
+  if (!isLowerGreaterOrEqual(rhs, -1) || !isUpperLessOrEqual(rhs, 1)) {
+    return {};
+  }
+
+  return applyIncreasing(rhs, mpfr_asin);
+}
+
+std::optional<RealBall> tryAcos(const RealBall &rhs) {
+  if (!isLowerGreaterOrEqual(rhs, -1) || !isUpperLessOrEqual(rhs, 1)) {
+    return {};
+  }
+
+  return applyDecreasing(rhs, mpfr_acos);
+}
+
+std::optional<RealBall> tryAtan(const RealBall &rhs) {
+  return applyIncreasing(rhs, mpfr_atan);
+}
+
+std::optional<RealBall> tryAcot(const RealBall &rhs) {
+  const std::optional<RealBall> inv = tryInverse(rhs);
+  return inv ? tryAtan(*inv) : std::nullopt;
+}
+
+std::optional<RealBall> tryAsec(const RealBall &rhs) {
+  const std::optional<RealBall> inv = tryInverse(rhs);
+  return inv ? tryAcos(*inv) : std::nullopt;
+}
+
+std::optional<RealBall> tryAcsc(const RealBall &rhs) {
+  const std::optional<RealBall> inv = tryInverse(rhs);
+  return inv ? tryAsin(*inv) : std::nullopt;
+}
+
+std::optional<RealBall> trySinh(const RealBall &rhs) {
+  return applyIncreasing(rhs, mpfr_sinh);
+}
+
+std::optional<RealBall> tryCosh(const RealBall &rhs) {
+  if (isLowerGreaterOrEqual(rhs, 0)) {
+    return applyIncreasing(rhs, mpfr_cosh);
+  }
+
+  if (isUpperLessOrEqual(rhs, 0)) {
+    return applyDecreasing(rhs, mpfr_cosh);
+  }
+
+  // The minimum is reached at zero
+  Backend lowerValue;
+  Backend upperValue;
+  mpfr_cosh(data(lowerValue), data(rhs.getLower()), MPFR_RNDU);
+  mpfr_cosh(data(upperValue), data(rhs.getUpper()), MPFR_RNDU);
+  return makeBall(Backend(1), max(lowerValue, upperValue));
+}
+
+std::optional<RealBall> tryTanh(const RealBall &rhs) {
+  return applyIncreasing(rhs, mpfr_tanh);
+}
+
+std::optional<RealBall> tryCoth(const RealBall &rhs) {
+  return tryInverse(tryTanh(rhs));
+}
+
+std::optional<RealBall> trySech(const RealBall &rhs) {
+  return tryInverse(tryCosh(rhs));
+}
+
+std::optional<RealBall> tryCsch(const RealBall &rhs) {
+  return tryInverse(trySinh(rhs));
+}
+
+std::optional<RealBall> tryAsinh(const RealBall &rhs) {
+  return applyIncreasing(rhs, mpfr_asinh);
+}
+
+std::optional<RealBall> tryAcosh(const RealBall &rhs) {
+  if (!isLowerGreaterOrEqual(rhs, 1)) {
+    return {};
+  }
+
+  return applyIncreasing(rhs, mpfr_acosh);
+}
+
+std::optional<RealBall> tryAtanh(const RealBall &rhs) {
+  if (!isLowerGreater(rhs, -1) || !isUpperLess(rhs, 1)) {
+    return {};
+  }
+
+  return applyIncreasing(rhs, mpfr_atanh);
+}
+
+std::optional<RealBall> tryAcoth(const RealBall &rhs) {
+  const std::optional<RealBall> inv = tryInverse(rhs);
+  return inv ? tryAtanh(*inv) : std::nullopt;
+}
+
+std::optional<RealBall> tryAsech(const RealBall &rhs) {
+  const std::optional<RealBall> inv = tryInverse(rhs);
+  return inv ? tryAcosh(*inv) : std::nullopt;
+}
+
+std::optional<RealBall> tryAcsch(const RealBall &rhs) {
+  const std::optional<RealBall> inv = tryInverse(rhs);
+  return inv ? tryAsinh(*inv) : std::nullopt;
+}
+
+}
+
+}
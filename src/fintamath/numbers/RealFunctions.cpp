@@ -1,6 +1,14 @@
 #include "fintamath/numbers/RealFunctions.hpp"
 
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 
 #include <fmt/core.h>
 
@@ -19,9 +27,64 @@ using namespace detail;
 
 namespace {
 
-constexpr std::string_view backendIsInfException = "Undefined backend inf";
-constexpr std::string_view backendIsNegInfException = "Undefined backend -inf";
-constexpr std::string_view backendIsNanException = "Undefined backend nan";
+constexpr std::string_view argumentOverflow = "argument overflow";
+constexpr std::string_view argumentOutOfRange = "argument out of range";
+constexpr std::string_view resultOverflow = "result overflow";
+constexpr std::string_view resultUnderflow = "result underflow";
+constexpr std::string_view divisionByZero = "division by zero";
+
+// Keeps a constant computed with the highest calculation precision requested so far,
+// values with lower precisions are rounded from it instead of being computed again
+class ConstantCache final {
+public:
+  using Function = std::function<Real()>;
+
+public:
+  explicit ConstantCache(Function inComputeFunction) : computeFunction(std::move(inComputeFunction)) {}
+
+  // Values are never removed, so returned references stay valid after the lock is released
+  const Real &get() {
+    const unsigned precision = Real::getCalculationPrecisionStatic();
+    std::optional<Real> value;
+
+    {
+      std::shared_lock lock(mutex);
+
+      if (auto iter = precisionToValueMap.find(precision); iter != precisionToValueMap.end()) {
+        return iter->second;
+      }
+
+      if (maxPrecisionValue && precision <= maxPrecision) {
+        value = Real(Real::Backend(maxPrecisionValue->getBackend(), precision));
+      }
+    }
+
+    // Computed without the lock, so the function may use other caches
+    if (!value) {
+      value = computeFunction();
+    }
+
+    std::scoped_lock lock(mutex);
+
+    if (!maxPrecisionValue || precision > maxPrecision) {
+      maxPrecision = precision;
+      maxPrecisionValue = value;
+    }
+
+    return precisionToValueMap.try_emplace(precision, std::move(*value)).first->second;
+  }
+
+private:
+  std::unordered_map<unsigned, Real> precisionToValueMap;
+
+  std::optional<Real> maxPrecisionValue;
+
+  unsigned maxPrecision = 0;
+
+  Function computeFunction;
+
+  std::shared_mutex mutex;
+};
 
 bool isOverflow(const Real &rhs) {
   static Cache<unsigned, Real::Backend> cache([](const unsigned precision) {
@@ -49,485 +112,620 @@ bool isLogUnderflow(const Real &rhs) {
   return !rhs.isZero() && abs(rhs) < cache[Real::getPrecisionStatic()];
 }
 
-std::string getExceptionMessage(const std::string_view message) {
-  if (message == backendIsInfException || message == backendIsNegInfException) {
-    return "result overflow";
-  }
-
-  if (message == backendIsNanException) {
-    return "argument out of range";
-  }
+const Real &getLn2() {
+  static ConstantCache cache([] {
+    Real::Backend res;
+    mpfr_const_log2(res.backend().data(), MPFR_RNDN);
+    return Real(res);
+  });
 
-  return std::string(message);
+  return cache.get();
 }
 
+const Real &getLn10() {
+  static ConstantCache cache([] {
+    Real::Backend res;
+    mpfr_log_ui(res.backend().data(), 10, MPFR_RNDN);
+    return Real(res);
+  });
+
+  return cache.get();
 }
 
-const Real &trigResultChecked(const Real &rhs) {
-  if (isUnderflow(rhs)) {
-    throw UndefinedException("result underflow");
-  }
+std::string undefinedMessage(const std::string_view funcName, const std::string_view cause, const auto &...args) {
+  std::string argsStr;
+  ((argsStr += (argsStr.empty() ? "" : ", ") + args.toString()), ...);
 
-  if (isOverflow(rhs)) {
-    throw UndefinedException("result overflow");
+  return fmt::format(
+      "{}({}) is undefined ({})",
+      funcName,
+      argsStr,
+      cause);
+}
+
+// Empty result of the try functions, the cause is written only if it is requested
+std::nullopt_t undefined(std::string *reason, const std::string_view cause) {
+  if (reason) {
+    *reason = cause;
   }
 
-  return rhs;
+  return std::nullopt;
 }
 
-const Real &hyperbResultChecked(const Real &rhs) {
-  if (isUnderflow(rhs)) {
-    throw UndefinedException("result underflow");
+// Nests the cause of an empty result of an inner call, so that messages look like thrown from the inner call
+template <typename Res>
+std::optional<Res> innerResult(std::optional<Res> res, std::string *reason, const std::string_view funcName, const auto &...args) {
+  if (!res && reason) {
+    *reason = undefinedMessage(funcName, *reason, args...);
   }
 
-  return rhs;
+  return res;
 }
 
-const Real &tgammaResultChecked(const Real &rhs) {
-  if (rhs.isZero()) {
-    throw UndefinedException("result overflow");
+std::optional<Real> makeReal(Real::Backend backend, std::string *reason) {
+  if (boost::math::isnan(backend)) {
+    return undefined(reason, argumentOutOfRange);
   }
 
-  return rhs;
+  if (boost::math::isinf(backend)) {
+    return undefined(reason, resultOverflow);
+  }
+
+  return Real(std::move(backend));
 }
 
-Integer floor(const Real &rhs) try {
-  if (isOverflow(rhs)) {
-    throw UndefinedException("argument overflow");
+std::optional<Real> divide(const std::optional<Real> &lhs, const std::optional<Real> &rhs, std::string *reason) {
+  if (!lhs || !rhs) {
+    return {};
   }
 
-  if (rhs.isNegZero()) {
-    return -1;
+  if (rhs->isZero()) {
+    if (reason) {
+      *reason = undefinedMessage("div", divisionByZero, *lhs, *rhs);
+    }
+
+    return {};
   }
 
-  const Real::Backend res = boost::multiprecision::floor(rhs.getBackend());
-  return res.convert_to<Integer::Backend>();
+  return *lhs / *rhs;
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "floor({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+std::optional<Real> inverse(const std::optional<Real> &rhs, std::string *reason) {
+  return divide(Real(1), rhs, reason);
 }
 
-Integer ceil(const Real &rhs) try {
-  if (isOverflow(rhs)) {
-    throw UndefinedException("argument overflow");
+std::optional<Real> trigResult(std::optional<Real> rhs, std::string *reason) {
+  if (rhs && isUnderflow(*rhs)) {
+    return undefined(reason, resultUnderflow);
   }
 
-  const Real::Backend res = boost::multiprecision::ceil(rhs.getBackend());
-  return res.convert_to<Integer::Backend>();
-}
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "ceil({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
-}
+  if (rhs && isOverflow(*rhs)) {
+    return undefined(reason, resultOverflow);
+  }
 
-Real abs(const Real &rhs) {
-  return rhs < 0 ? -rhs : rhs;
+  return rhs;
 }
 
-Real sqrt(const Real &rhs) try {
-  if (rhs < 0) {
-    throw UndefinedException("expected argument >= 0");
+std::optional<Real> hyperbResult(std::optional<Real> rhs, std::string *reason) {
+  if (rhs && isUnderflow(*rhs)) {
+    return undefined(reason, resultUnderflow);
   }
 
-  return {sqrt(rhs.getBackend())};
-}
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "sqrt({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+  return rhs;
 }
 
-Real pow(const Real &lhs, const Real &rhs) try {
-  if (lhs.isZero() && rhs.isZero()) {
-    throw UndefinedException("zero to the power of zero");
+template <typename Res>
+Res valueOrThrow(std::optional<Res> res, const std::string &reason, const std::string_view funcName, const auto &...args) {
+  if (!res) {
+    throw UndefinedException(undefinedMessage(funcName, reason, args...));
   }
 
-  if (lhs.isNegZero()) {
-    return Real(0) * pow(Real(-1), rhs);
-  }
+  return std::move(*res);
+}
+}
 
-  return {pow(lhs.getBackend(), rhs.getBackend())};
+Integer floor(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryFloor(rhs, &reason), reason, "floor", rhs);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "pow({}, {}) is undefined ({})",
-      lhs.toString(),
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+Integer ceil(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryCeil(rhs, &reason), reason, "ceil", rhs);
 }
 
-Real exp(const Real &rhs) try {
-  return {exp(rhs.getBackend())};
+Real abs(const Real &rhs) {
+  return rhs < 0 ? -rhs : rhs;
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "exp({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+Real sqrt(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(trySqrt(rhs, &reason), reason, "sqrt", rhs);
 }
 
-Real log(const Real &lhs, const Real &rhs) try {
-  Real divLhs = ln(rhs);
-  Real divRhs = ln(lhs);
-  return divLhs / divRhs;
+Real pow(const Real &lhs, const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryPow(lhs, rhs, &reason), reason, "pow", lhs, rhs);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "log({}, {}) is undefined ({})",
-      lhs.toString(),
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+Real pow(const Real &lhs, const Integer &rhs) {
+  std::string reason;
+  return valueOrThrow(tryPow(lhs, rhs, &reason), reason, "pow", lhs, rhs);
 }
 
-Real ln(const Real &rhs) try {
-  if (rhs <= 0) {
-    throw UndefinedException("expected argument > 0");
-  }
+Real exp(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryExp(rhs, &reason), reason, "exp", rhs);
+}
 
-  Real res = {log(rhs.getBackend())};
+Real log(const Real &lhs, const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryLog(lhs, rhs, &reason), reason, "log", lhs, rhs);
+}
 
-  if (isLogUnderflow(res)) {
-    throw UndefinedException("underflow");
-  }
+Real ln(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryLn(rhs, &reason), reason, "ln", rhs);
+}
 
-  return res;
+Real lb(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryLb(rhs, &reason), reason, "lb", rhs);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "ln({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+Real lg(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryLg(rhs, &reason), reason, "lg", rhs);
 }
 
-Real lb(const Real &rhs) try {
-  static const Real divisor = ln(2);
-  return ln(rhs) / divisor;
+Real sin(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(trySin(rhs, &reason), reason, "sin", rhs);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "lb({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+Real cos(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryCos(rhs, &reason), reason, "cos", rhs);
 }
 
-Real lg(const Real &rhs) try {
-  static const Real divisor = ln(10);
-  return ln(rhs) / divisor;
+Real tan(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryTan(rhs, &reason), reason, "tan", rhs);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "lg({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+Real cot(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryCot(rhs, &reason), reason, "cot", rhs);
 }
 
-Real sin(const Real &rhs) try {
-  if (isOverflow(rhs)) {
-    throw UndefinedException("argument overflow");
-  }
+Real sec(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(trySec(rhs, &reason), reason, "sec", rhs);
+}
 
-  return trigResultChecked({sin(rhs.getBackend())});
+Real csc(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryCsc(rhs, &reason), reason, "csc", rhs);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "sin({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+Real asin(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryAsin(rhs, &reason), reason, "asin", rhs);
 }
 
-Real cos(const Real &rhs) try {
-  if (isOverflow(rhs)) {
-    throw UndefinedException("argument overflow");
-  }
+Real acos(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryAcos(rhs, &reason), reason, "acos", rhs);
+}
 
-  return trigResultChecked({cos(rhs.getBackend())});
+Real atan(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryAtan(rhs, &reason), reason, "atan", rhs);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "cos({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+Real acot(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryAcot(rhs, &reason), reason, "acot", rhs);
 }
 
-Real tan(const Real &rhs) try {
-  if (isOverflow(rhs)) {
-    throw UndefinedException("argument overflow");
-  }
+Real asec(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryAsec(rhs, &reason), reason, "asec", rhs);
+}
 
-  return trigResultChecked({tan(rhs.getBackend())});
+Real acsc(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryAcsc(rhs, &reason), reason, "acsc", rhs);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "tan({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+Real sinh(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(trySinh(rhs, &reason), reason, "sinh", rhs);
 }
 
-Real cot(const Real &rhs) try {
-  return 1 / tan(rhs);
+Real cosh(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryCosh(rhs, &reason), reason, "cosh", rhs);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "cot({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+Real tanh(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryTanh(rhs, &reason), reason, "tanh", rhs);
 }
 
-Real sec(const Real &rhs) try {
-  return 1 / cos(rhs);
+Real coth(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryCoth(rhs, &reason), reason, "coth", rhs);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "sec({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+Real sech(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(trySech(rhs, &reason), reason, "sech", rhs);
 }
 
-Real csc(const Real &rhs) try {
-  return 1 / sin(rhs);
+Real csch(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryCsch(rhs, &reason), reason, "csch", rhs);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "csc({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+Real asinh(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryAsinh(rhs, &reason), reason, "asinh", rhs);
 }
 
-Real asin(const Real &rhs) try {
-  return trigResultChecked({asin(rhs.getBackend())});
+Real acosh(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryAcosh(rhs, &reason), reason, "acosh", rhs);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "asin({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+Real atanh(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryAtanh(rhs, &reason), reason, "atanh", rhs);
 }
 
-Real acos(const Real &rhs) try {
-  return trigResultChecked({acos(rhs.getBackend())});
+Real acoth(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryAcoth(rhs, &reason), reason, "acoth", rhs);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "acos({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+Real asech(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryAsech(rhs, &reason), reason, "asech", rhs);
 }
 
-Real atan(const Real &rhs) try {
-  return trigResultChecked({atan(rhs.getBackend())});
+Real acsch(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryAcsch(rhs, &reason), reason, "acsch", rhs);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "atan({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+Real tgamma(const Real &rhs) {
+  std::string reason;
+  return valueOrThrow(tryTgamma(rhs, &reason), reason, "tgamma", rhs);
 }
 
-Real acot(const Real &rhs) try {
-  return atan(1 / rhs);
+const Real &getE() {
+  static ConstantCache cache([] {
+    Real::Backend::backend_type res;
+    boost::multiprecision::default_ops::calc_e(res, Real::getCalculationPrecisionStatic());
+    return Real(res);
+  });
+
+  return cache.get();
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "acot({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+const Real &getPi() {
+  static ConstantCache cache([] {
+    Real::Backend::backend_type res;
+    boost::multiprecision::default_ops::calc_pi(res, Real::getCalculationPrecisionStatic());
+    return Real(res);
+  });
+
+  return cache.get();
 }
 
-Real asec(const Real &rhs) try {
-  return acos(1 / rhs);
+const Real &getEulerGamma() {
+  static ConstantCache cache([] {
+    Real::Backend res;
+    mpfr_const_euler(res.backend().data(), MPFR_RNDN);
+    return Real(res);
+  });
+
+  return cache.get();
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "asec({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+namespace detail {
+
+std::optional<Integer> tryFloor(const Real &rhs, std::string *reason) {
+  if (isOverflow(rhs)) {
+    return undefined(reason, argumentOverflow);
+  }
+
+  if (rhs.isNegZero()) {
+    return -1;
+  }
+
+  const Real::Backend res = boost::multiprecision::floor(rhs.getBackend());
+  return Integer(res.convert_to<Integer::Backend>());
 }
 
-Real acsc(const Real &rhs) try {
-  return asin(1 / rhs);
+std::optional<Integer> tryCeil(const Real &rhs, std::string *reason) {
+  if (isOverflow(rhs)) {
+    return undefined(reason, argumentOverflow);
+  }
+
+  const Real::Backend res = boost::multiprecision::ceil(rhs.getBackend());
+  return Integer(res.convert_to<Integer::Backend>());
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "acsc({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+std::optional<Real> trySqrt(const Real &rhs, std::string *reason) {
+  if (rhs < 0) {
+    return undefined(reason, "expected argument >= 0");
+  }
+
+  return makeReal(sqrt(rhs.getBackend()), reason);
 }
 
-Real sinh(const Real &rhs) try {
-  return hyperbResultChecked({sinh(rhs.getBackend())});
+std::optional<Real> tryPow(const Real &lhs, const Real &rhs, std::string *reason) {
+  if (lhs.isZero() && rhs.isZero()) {
+    return undefined(reason, "zero to the power of zero");
+  }
+
+  if (lhs.isNegZero()) {
+    if (auto res = innerResult(tryPow(Real(-1), rhs, reason), reason, "pow", Real(-1), rhs)) {
+      return Real(0) * *res;
+    }
+
+    return {};
+  }
+
+  return makeReal(pow(lhs.getBackend(), rhs.getBackend()), reason);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "sinh({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+std::optional<Real> tryPow(const Real &lhs, const Integer &rhs, std::string *reason) {
+  if (lhs.isZero() && rhs == 0) {
+    return undefined(reason, "zero to the power of zero");
+  }
+
+  if (lhs.isNegZero()) {
+    if (auto res = innerResult(tryPow(Real(-1), rhs, reason), reason, "pow", Real(-1), rhs)) {
+      return Real(0) * *res;
+    }
+
+    return {};
+  }
+
+  Real::Backend res;
+  mpfr_pow_z(res.backend().data(), lhs.getBackend().backend().data(), rhs.getBackend().backend().data(), MPFR_RNDN);
+  return makeReal(std::move(res), reason);
 }
 
-Real cosh(const Real &rhs) try {
-  return hyperbResultChecked({cosh(rhs.getBackend())});
+std::optional<Real> tryExp(const Real &rhs, std::string *reason) {
+  return makeReal(exp(rhs.getBackend()), reason);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "cosh({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+std::optional<Real> tryLog(const Real &lhs, const Real &rhs, std::string *reason) {
+  const auto divLhs = innerResult(tryLn(rhs, reason), reason, "ln", rhs);
+
+  if (!divLhs) {
+    return {};
+  }
+
+  return divide(divLhs, innerResult(tryLn(lhs, reason), reason, "ln", lhs), reason);
 }
 
-Real tanh(const Real &rhs) try {
-  return hyperbResultChecked({tanh(rhs.getBackend())});
+std::optional<Real> tryLn(const Real &rhs, std::string *reason) {
+  if (rhs <= 0) {
+    return undefined(reason, "expected argument > 0");
+  }
+
+  auto res = makeReal(log(rhs.getBackend()), reason);
+
+  if (res && isLogUnderflow(*res)) {
+    return undefined(reason, "underflow");
+  }
+
+  return res;
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "tanh({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+std::optional<Real> tryLb(const Real &rhs, std::string *reason) {
+  if (auto res = innerResult(tryLn(rhs, reason), reason, "ln", rhs)) {
+    return *res / getLn2();
+  }
+
+  return {};
 }
 
-Real coth(const Real &rhs) try {
-  return 1 / tanh(rhs);
+std::optional<Real> tryLg(const Real &rhs, std::string *reason) {
+  if (auto res = innerResult(tryLn(rhs, reason), reason, "ln", rhs)) {
+    return *res / getLn10();
+  }
+
+  return {};
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "coth({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+std::optional<Real> trySin(const Real &rhs, std::string *reason) {
+  if (isOverflow(rhs)) {
+    return undefined(reason, argumentOverflow);
+  }
+
+  return trigResult(makeReal(sin(rhs.getBackend()), reason), reason);
 }
 
-Real sech(const Real &rhs) try {
-  return 1 / cosh(rhs);
+std::optional<Real> tryCos(const Real &rhs, std::string *reason) {
+  if (isOverflow(rhs)) {
+    return undefined(reason, argumentOverflow);
+  }
+
+  return trigResult(makeReal(cos(rhs.getBackend()), reason), reason);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "sech({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+std::optional<Real> tryTan(const Real &rhs, std::string *reason) {
+  if (isOverflow(rhs)) {
+    return undefined(reason, argumentOverflow);
+  }
+
+  return trigResult(makeReal(tan(rhs.getBackend()), reason), reason);
 }
 
-Real csch(const Real &rhs) try {
-  return 1 / sinh(rhs);
+std::optional<Real> tryCot(const Real &rhs, std::string *reason) {
+  return inverse(innerResult(tryTan(rhs, reason), reason, "tan", rhs), reason);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "csch({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+std::optional<Real> trySec(const Real &rhs, std::string *reason) {
+  return inverse(innerResult(tryCos(rhs, reason), reason, "cos", rhs), reason);
 }
 
-Real asinh(const Real &rhs) try {
-  return hyperbResultChecked(boost::math::asinh(rhs.getBackend()));
+std::optional<Real> tryCsc(const Real &rhs, std::string *reason) {
+  return inverse(innerResult(trySin(rhs, reason), reason, "sin", rhs), reason);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "asinh({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+std::optional<Real> tryAsin(const Real &rhs, std::string *reason) {
+  return trigResult(makeReal(asin(rhs.getBackend()), reason), reason);
 }
 
-Real acosh(const Real &rhs) try {
-  try {
-    return boost::math::acosh(rhs.getBackend());
-  }
-  catch (const boost::math::evaluation_error &) {
-    throw UndefinedException("argument out of range");
-  }
+std::optional<Real> tryAcos(const Real &rhs, std::string *reason) {
+  return trigResult(makeReal(acos(rhs.getBackend()), reason), reason);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "acosh({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+std::optional<Real> tryAtan(const Real &rhs, std::string *reason) {
+  return trigResult(makeReal(atan(rhs.getBackend()), reason), reason);
 }
 
-Real atanh(const Real &rhs) try {
-  try {
-    return hyperbResultChecked(boost::math::atanh(rhs.getBackend()));
+std::optional<Real> tryAcot(const Real &rhs, std::string *reason) {
+  if (auto inv = inverse(rhs, reason)) {
+    return innerResult(tryAtan(*inv, reason), reason, "atan", *inv);
   }
-  catch (const std::overflow_error &) {
-    throw UndefinedException("result overflow");
+
+  return {};
+}
+
+std::optional<Real> tryAsec(const Real &rhs, std::string *reason) {
+  if (auto inv = inverse(rhs, reason)) {
+    return innerResult(tryAcos(*inv, reason), reason, "acos", *inv);
   }
-  catch (const boost::math::evaluation_error &) {
-    throw UndefinedException("argument out of range");
+
+  return {};
+}
+
+std::optional<Real> tryAcsc(const Real &rhs, std::string *reason) {
+  if (auto inv = inverse(rhs, reason)) {
+    return innerResult(tryAsin(*inv, reason), reason, "asin", *inv);
   }
+
+  return {};
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "atanh({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+std::optional<Real> trySinh(const Real &rhs, std::string *reason) {
+  return hyperbResult(makeReal(sinh(rhs.getBackend()), reason), reason);
 }
 
-Real acoth(const Real &rhs) try {
-  return atanh(1 / rhs);
+std::optional<Real> tryCosh(const Real &rhs, std::string *reason) {
+  return hyperbResult(makeReal(cosh(rhs.getBackend()), reason), reason);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "acoth({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+std::optional<Real> tryTanh(const Real &rhs, std::string *reason) {
+  return hyperbResult(makeReal(tanh(rhs.getBackend()), reason), reason);
 }
 
-Real asech(const Real &rhs) try {
-  return acosh(1 / rhs);
+std::optional<Real> tryCoth(const Real &rhs, std::string *reason) {
+  return inverse(innerResult(tryTanh(rhs, reason), reason, "tanh", rhs), reason);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "asech({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+std::optional<Real> trySech(const Real &rhs, std::string *reason) {
+  return inverse(innerResult(tryCosh(rhs, reason), reason, "cosh", rhs), reason);
 }
 
-Real acsch(const Real &rhs) try {
-  return asinh(1 / rhs);
+std::optional<Real> tryCsch(const Real &rhs, std::string *reason) {
+  return inverse(innerResult(trySinh(rhs, reason), reason, "sinh", rhs), reason);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "acsch({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+std::optional<Real> tryAsinh(const Real &rhs, std::string *reason) {
+  return hyperbResult(makeReal(boost::math::asinh(rhs.getBackend()), reason), reason);
 }
 
-Real tgamma(const Real &rhs) try {
-  try {
-    return tgammaResultChecked(boost::math::tgamma(rhs.getBackend()));
+std::optional<Real> tryAcosh(const Real &rhs, std::string *reason) {
+  // Checked here because boost reports the domain error by throwing
+  if (rhs < 1) {
+    return undefined(reason, argumentOutOfRange);
   }
-  catch (const std::overflow_error &) {
-    throw UndefinedException("result overflow");
+
+  return makeReal(boost::math::acosh(rhs.getBackend()), reason);
+}
+
+std::optional<Real> tryAtanh(const Real &rhs, std::string *reason) {
+  // Checked here because boost reports the domain and pole errors by throwing
+  const Real rhsAbs = abs(rhs);
+
+  if (rhsAbs > 1) {
+    return undefined(reason, argumentOutOfRange);
   }
-  catch (const boost::math::evaluation_error &) {
-    throw UndefinedException("argument out of range");
+
+  if (rhsAbs == 1) {
+    return undefined(reason, resultOverflow);
   }
+
+  return hyperbResult(makeReal(boost::math::atanh(rhs.getBackend()), reason), reason);
 }
-catch (const UndefinedException &exc) {
-  throw UndefinedException(fmt::format(
-      "tgamma({}) is undefined ({})",
-      rhs.toString(),
-      getExceptionMessage(exc.what())));
+
+std::optional<Real> tryAcoth(const Real &rhs, std::string *reason) {
+  if (auto inv = inverse(rhs, reason)) {
+    return innerResult(tryAtanh(*inv, reason), reason, "atanh", *inv);
+  }
+
+  return {};
 }
 
-const Real &getE() {
-  static Cache<unsigned, Real> cache([](const unsigned precision) {
-    Real::Backend::backend_type res;
-    boost::multiprecision::default_ops::calc_e(res, precision);
-    return Real(res);
-  });
+std::optional<Real> tryAsech(const Real &rhs, std::string *reason) {
+  if (auto inv = inverse(rhs, reason)) {
+    return innerResult(tryAcosh(*inv, reason), reason, "acosh", *inv);
+  }
 
-  return cache[Real::getCalculationPrecisionStatic()];
+  return {};
 }
 
-const Real &getPi() {
-  static Cache<unsigned, Real> cache([](const unsigned precision) {
-    Real::Backend::backend_type res;
-    boost::multiprecision::default_ops::calc_pi(res, precision);
-    return Real(res);
-  });
+std::optional<Real> tryAcsch(const Real &rhs, std::string *reason) {
+  if (auto inv = inverse(rhs, reason)) {
+    return innerResult(tryAsinh(*inv, reason), reason, "asinh", *inv);
+  }
+
+  return {};
+}
+
+std::optional<Real> tryTgamma(const Real &rhs, std::string *reason) {
+  // Poles are checked here, only rare overflows are reported by boost exceptions
+  if (rhs.isZero()) {
+    return undefined(reason, resultOverflow);
+  }
+
+  if (rhs < 0) {
+    const auto rhsFloor = tryFloor(rhs);
+
+    if (!rhsFloor) {
+      return undefined(reason, resultOverflow);
+    }
+
+    if (rhs == *rhsFloor) {
+      return undefined(reason, argumentOutOfRange);
+    }
+  }
+
+  try {
+    auto res = makeReal(boost::math::tgamma(rhs.getBackend()), reason);
+
+    if (res && res->isZero()) {
+      return undefined(reason, resultOverflow);
+    }
+
+    return res;
+  }
+  catch (const std::overflow_error &) {
+    return undefined(reason, resultOverflow);
+  }
+  catch (const boost::math::evaluation_error &) {
+    return undefined(reason, argumentOutOfRange);
+  }
+}
 
-  return cache[Real::getCalculationPrecisionStatic()];
 }
 
 }
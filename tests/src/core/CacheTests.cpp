@@ -2,11 +2,48 @@
 
 #include "fintamath/core/Cache.hpp"
 
-#include "fintamath/literals/constants/E.hpp"
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "fintamath/numbers/Integer.hpp"
 
 using namespace fintamath;
+using namespace detail;
 
 TEST(CacheTests, atTest) {
-  // TODO: implement
+  int calls = 0;
+
+  Cache<int, Integer> cache([&calls](const int key) {
+    calls++;
+    return Integer(key) * 2;
+  });
+
+  EXPECT_EQ(cache[1], 2);
+  EXPECT_EQ(cache[2], 4);
+  EXPECT_EQ(calls, 2);
+
+  const Integer &value = cache[1];
+  EXPECT_EQ(&value, &cache[1]);
+  EXPECT_EQ(calls, 2);
+}
+
+TEST(CacheTests, atThreadsTest) {
+  Cache<int, std::string> cache([](const int key) {
+    return std::to_string(key);
+  });
+
+  std::vector<std::thread> threads;
+
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([&cache] {
+      for (int key = 0; key < 1000; key++) {
+        EXPECT_EQ(cache[key], std::to_string(key));
+      }
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
 }
@@ -1,7 +1,12 @@
 #include <gtest/gtest.h>
 
+#include "fintamath/core/IArithmetic.hpp"
 #include "fintamath/core/MathObjectBody.hpp"
+#include "fintamath/core/MathObjectUtils.hpp"
 #include "fintamath/core/None.hpp"
+#include "fintamath/numbers/INumber.hpp"
+#include "fintamath/numbers/Integer.hpp"
+#include "fintamath/numbers/Rational.hpp"
 
 using namespace fintamath;
 using namespace detail;
@@ -50,6 +55,12 @@ class OtherChildTest : public IParentTest2 {
 
 FINTAMATH_CLASS_IMPLEMENTATION(OtherChildTest)
 
+class LateChildTest : public IParentTest1 {
+  FINTAMATH_CLASS_BODY(LateChildTest, IParentTest1)
+};
+
+FINTAMATH_CLASS_IMPLEMENTATION(LateChildTest)
+
 [[maybe_unused]] const auto config = [] {
   ISuperParentTest::registerType<IParentTest1>();
   IParentTest1::registerType<ChildTest1>();
@@ -94,3 +105,64 @@ TEST(MathObjectClassTests, getParentTest) {
   EXPECT_EQ(ChildTest2::getClassStatic()->getParent(), IParentTest1::getClassStatic());
   EXPECT_EQ(ChildTest3::getClassStatic()->getParent(), IParentTest2::getClassStatic());
 }
+
+TEST(MathObjectClassTests, getSubtreeTest) {
+  EXPECT_EQ(MathObjectClassImpl("Test").getSubtreeBegin(), 0);
+  EXPECT_EQ(MathObjectClassImpl("Test").getSubtreeEnd(), 0);
+  EXPECT_EQ(OtherChildTest::getClassStatic()->getSubtreeBegin(), 0);
+
+  const MathObjectClass arithmetic = IArithmetic::getClassStatic();
+  const MathObjectClass number = INumber::getClassStatic();
+  const MathObjectClass integer = Integer::getClassStatic();
+  const MathObjectClass rational = Rational::getClassStatic();
+
+  for (const MathObjectClass objClass : {arithmetic, number, integer, rational}) {
+    EXPECT_NE(objClass->getSubtreeBegin(), 0);
+    EXPECT_LT(objClass->getSubtreeBegin(), objClass->getSubtreeEnd());
+  }
+
+  EXPECT_EQ(integer->getSubtreeEnd() - integer->getSubtreeBegin(), 1);
+  EXPECT_TRUE(is(arithmetic, integer));
+  EXPECT_TRUE(is(number, rational));
+  EXPECT_FALSE(is(integer, number));
+  EXPECT_FALSE(is(integer, rational));
+
+  const MathObjectClass superParent = ISuperParentTest::getClassStatic();
+  const MathObjectClass parent1 = IParentTest1::getClassStatic();
+  const MathObjectClass parent2 = IParentTest2::getClassStatic();
+  const MathObjectClass child1 = ChildTest1::getClassStatic();
+  const MathObjectClass child2 = ChildTest2::getClassStatic();
+  const MathObjectClass child3 = ChildTest3::getClassStatic();
+
+  EXPECT_TRUE(is(superParent, child3));
+  EXPECT_TRUE(is(parent1, child2));
+  EXPECT_TRUE(is(parent2, parent2));
+  EXPECT_FALSE(is(parent1, child3));
+  EXPECT_FALSE(is(child1, parent1));
+  EXPECT_FALSE(is(child1, child2));
+
+  EXPECT_TRUE(is(parent2, OtherChildTest::getClassStatic()));
+  EXPECT_TRUE(is(superParent, OtherChildTest::getClassStatic()));
+  EXPECT_FALSE(is(parent1, OtherChildTest::getClassStatic()));
+  EXPECT_FALSE(is(OtherChildTest::getClassStatic(), parent2));
+}
+
+TEST(MathObjectClassTests, registerAfterNumberingTest) {
+  const MathObjectClass number = INumber::getClassStatic();
+  const size_t numberBegin = number->getSubtreeBegin();
+  const size_t numberEnd = number->getSubtreeEnd();
+
+  const MathObjectClass lateChild = LateChildTest::getClassStatic();
+  IParentTest1::registerType<LateChildTest>();
+
+  // The numbering is not changed, the late class is checked by its parents
+  EXPECT_NE(lateChild->getId(), 0);
+  EXPECT_EQ(lateChild->getSubtreeBegin(), 0);
+  EXPECT_EQ(number->getSubtreeBegin(), numberBegin);
+  EXPECT_EQ(number->getSubtreeEnd(), numberEnd);
+
+  EXPECT_TRUE(is(IParentTest1::getClassStatic(), lateChild));
+  EXPECT_TRUE(is(ISuperParentTest::getClassStatic(), lateChild));
+  EXPECT_FALSE(is(IParentTest2::getClassStatic(), lateChild));
+  EXPECT_FALSE(is(lateChild, IParentTest1::getClassStatic()));
+}
@@ -2,8 +2,101 @@
 
 #include "fintamath/core/MultiMethod.hpp"
 
+#include "fintamath/core/IMathObject.hpp"
+#include "fintamath/literals/Variable.hpp"
+#include "fintamath/numbers/Integer.hpp"
+#include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/Real.hpp"
+
 using namespace fintamath;
+using namespace detail;
+
+namespace {
+
+class TestMathObject : public IMathObjectCRTP<TestMathObject> {
+  FINTAMATH_CLASS_BODY(TestMathObject, IMathObject)
+};
+
+FINTAMATH_CLASS_IMPLEMENTATION(TestMathObject)
+
+using TestMultiMethod = MultiMethod<std::string(const IMathObject &, const IMathObject &)>;
+
+}
+
+TEST(MultimethodTests, callTest) {
+  TestMultiMethod multiMethod;
+
+  multiMethod.add<Integer, Integer>([](const Integer &lhs, const Integer &rhs) {
+    return "Integer " + lhs.toString() + " Integer " + rhs.toString();
+  });
+  multiMethod.add<Integer, Rational>([](const Integer &lhs, const Rational &rhs) {
+    return "Integer " + lhs.toString() + " Rational " + rhs.toString();
+  });
+  multiMethod.add<Rational, Real>([](const Rational &lhs, const Real & /*rhs*/) {
+    return "Rational " + lhs.toString() + " Real";
+  });
+
+  EXPECT_EQ(multiMethod(Integer(1), Integer(2)), "Integer 1 Integer 2");
+  EXPECT_EQ(multiMethod(Integer(1), Rational(1, 2)), "Integer 1 Rational 1/2");
+  EXPECT_EQ(multiMethod(Rational(1, 3), Real("1.5")), "Rational 1/3 Real");
+
+  EXPECT_EQ(multiMethod(Rational(1, 2), Integer(1)), "");
+  EXPECT_EQ(multiMethod(Real("1.5"), Rational(1, 3)), "");
+  EXPECT_EQ(multiMethod(Variable("x"), Integer(1)), "");
+
+  multiMethod.add<Integer, Integer>([](const Integer & /*lhs*/, const Integer & /*rhs*/) {
+    return std::string("replaced");
+  });
+
+  EXPECT_EQ(multiMethod(Integer(1), Integer(2)), "replaced");
+  EXPECT_EQ(multiMethod(Integer(1), Rational(1, 2)), "Integer 1 Rational 1/2");
+}
+
+TEST(MultimethodTests, callUnregisteredTest) {
+  TestMultiMethod multiMethod;
+
+  multiMethod.add<TestMathObject, Integer>([](const TestMathObject & /*lhs*/, const Integer &rhs) {
+    return "TestMathObject Integer " + rhs.toString();
+  });
+  multiMethod.add<Integer, Integer>([](const Integer &lhs, const Integer &rhs) {
+    return "Integer " + lhs.toString() + " Integer " + rhs.toString();
+  });
+
+  EXPECT_EQ(multiMethod(TestMathObject(), Integer(1)), "TestMathObject Integer 1");
+  EXPECT_EQ(multiMethod(Integer(1), Integer(2)), "Integer 1 Integer 2");
+  EXPECT_EQ(multiMethod(Integer(1), TestMathObject()), "");
+}
+
+TEST(MultimethodTests, containsTest) {
+  TestMultiMethod multiMethod;
+
+  multiMethod.add<Integer, Rational>([](const Integer & /*lhs*/, const Rational & /*rhs*/) {
+    return std::string();
+  });
+  multiMethod.add<TestMathObject, TestMathObject>([](const TestMathObject & /*lhs*/, const TestMathObject & /*rhs*/) {
+    return std::string();
+  });
+
+  EXPECT_TRUE(multiMethod.contains(Integer(), Rational()));
+  EXPECT_TRUE(multiMethod.contains(TestMathObject(), TestMathObject()));
+  EXPECT_FALSE(multiMethod.contains(Rational(), Integer()));
+  EXPECT_FALSE(multiMethod.contains(Integer(), Integer()));
+  EXPECT_FALSE(multiMethod.contains(TestMathObject(), Rational()));
+}
+
+TEST(MultimethodTests, copyTest) {
+  TestMultiMethod multiMethod;
+
+  multiMethod.add<Integer, Integer>([](const Integer & /*lhs*/, const Integer & /*rhs*/) {
+    return std::string("Integer Integer");
+  });
+
+  const TestMultiMethod multiMethodCopy = multiMethod;
+
+  multiMethod.add<Integer, Integer>([](const Integer & /*lhs*/, const Integer & /*rhs*/) {
+    return std::string("replaced");
+  });
 
-TEST(MultimethodTests, multimethodTest) {
-  // TODO: implement
+  EXPECT_EQ(multiMethodCopy(Integer(), Integer()), "Integer Integer");
+  EXPECT_EQ(multiMethod(Integer(), Integer()), "replaced");
 }
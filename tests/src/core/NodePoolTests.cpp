@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+
+#include "fintamath/core/NodePool.hpp"
+
+#include <cstring>
+#include <future>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace fintamath;
+using namespace detail;
+
+TEST(NodePoolTests, allocateTest) {
+  std::vector<void *> ptrs;
+
+  for (size_t size = 1; size <= NodePool::maxBlockSize * 2; size += 7) {
+    void *ptr = NodePool::allocate(size);
+    ASSERT_NE(ptr, nullptr);
+    std::memset(ptr, 0xFF, size);
+    ptrs.emplace_back(ptr);
+  }
+
+  EXPECT_EQ(std::set(ptrs.begin(), ptrs.end()).size(), ptrs.size());
+
+  size_t size = 1;
+  for (void *ptr : ptrs) {
+    NodePool::deallocate(ptr, size);
+    size += 7;
+  }
+}
+
+TEST(NodePoolTests, deallocateTest) {
+  NodePool::deallocate(nullptr, 8);
+
+  void *ptr1 = NodePool::allocate(40);
+  NodePool::deallocate(ptr1, 40);
+
+  void *ptr2 = NodePool::allocate(48);
+  EXPECT_NE(ptr2, nullptr);
+  NodePool::deallocate(ptr2, 48);
+
+  void *ptr3 = NodePool::allocate(NodePool::maxBlockSize + 1);
+  NodePool::deallocate(ptr3, NodePool::maxBlockSize + 1);
+}
+
+TEST(NodePoolTests, threadsTest) {
+  std::vector<void *> ptrs(1000);
+
+  std::thread allocator([&ptrs] {
+    for (auto &ptr : ptrs) {
+      ptr = NodePool::allocate(64);
+    }
+  });
+  allocator.join();
+
+  std::thread deallocator([&ptrs] {
+    for (void *ptr : ptrs) {
+      NodePool::deallocate(ptr, 64);
+    }
+  });
+  deallocator.join();
+
+  void *ptr = NodePool::allocate(64);
+  EXPECT_NE(ptr, nullptr);
+  NodePool::deallocate(ptr, 64);
+}
+
+TEST(NodePoolTests, crossThreadsDeallocateTest) {
+  constexpr size_t size = 200;
+
+  void *probePtr = NodePool::allocate(size);
+  NodePool::deallocate(probePtr, size);
+  void *reusedPtr = NodePool::allocate(size);
+  NodePool::deallocate(reusedPtr, size);
+
+  if (reusedPtr != probePtr) {
+    GTEST_SKIP() << "Blocks are not pooled";
+  }
+
+  std::vector<void *> ptrs(1000);
+
+  for (auto &ptr : ptrs) {
+    ptr = NodePool::allocate(size);
+  }
+
+  std::promise<void> deallocated;
+  std::promise<void> finished;
+
+  // The deallocating thread stays alive, so its blocks are not handed over on exit
+  std::thread deallocator([&] {
+    for (void *ptr : ptrs) {
+      NodePool::deallocate(ptr, size);
+    }
+
+    deallocated.set_value();
+    finished.get_future().wait();
+  });
+
+  deallocated.get_future().wait();
+
+  const std::set<void *> deallocatedPtrs(ptrs.begin(), ptrs.end());
+  size_t reusedCount = 0;
+
+  for (auto &ptr : ptrs) {
+    ptr = NodePool::allocate(size);
+    reusedCount += deallocatedPtrs.contains(ptr) ? 1 : 0;
+  }
+
+  EXPECT_GE(reusedCount, ptrs.size() / 2);
+
+  finished.set_value();
+  deallocator.join();
+
+  for (void *ptr : ptrs) {
+    NodePool::deallocate(ptr, size);
+  }
+}
+
+namespace {
+
+struct ExitDeallocator {
+  std::vector<void *> ptrs;
+
+  size_t size = 0;
+
+  ~ExitDeallocator() {
+    for (void *ptr : ptrs) {
+      NodePool::deallocate(ptr, size);
+    }
+  }
+};
+
+}
+
+TEST(NodePoolTests, deallocateAfterThreadExitTest) {
+  constexpr size_t size = 248;
+
+  void *probePtr = NodePool::allocate(size);
+  NodePool::deallocate(probePtr, size);
+  void *reusedPtr = NodePool::allocate(size);
+  NodePool::deallocate(reusedPtr, size);
+
+  if (reusedPtr != probePtr) {
+    GTEST_SKIP() << "Blocks are not pooled";
+  }
+
+  std::vector<void *> ptrs(1000);
+
+  for (auto &ptr : ptrs) {
+    ptr = NodePool::allocate(size);
+  }
+
+  std::thread deallocator([&ptrs] {
+    // Constructed before the pool is used by this thread, so it is destroyed after the thread's lists are handed over
+    thread_local ExitDeallocator exitDeallocator;
+    exitDeallocator.ptrs = ptrs;
+    exitDeallocator.size = size;
+
+    NodePool::deallocate(NodePool::allocate(size), size);
+  });
+  deallocator.join();
+
+  const std::set<void *> deallocatedPtrs(ptrs.begin(), ptrs.end());
+  size_t reusedCount = 0;
+
+  for (auto &ptr : ptrs) {
+    ptr = NodePool::allocate(size);
+    reusedCount += deallocatedPtrs.contains(ptr) ? 1 : 0;
+  }
+
+  EXPECT_GE(reusedCount, ptrs.size() / 2);
+
+  for (void *ptr : ptrs) {
+    NodePool::deallocate(ptr, size);
+  }
+}
@@ -55,6 +55,10 @@ TEST(ParserTests, parseFirstTest) {
   EXPECT_EQ(IMathObject::parseFirst("E").value()->getClass(), E::getClassStatic());
   EXPECT_EQ(IMathObject::parseFirst("1+1").value()->getClass(), Expression::getClassStatic());
   EXPECT_FALSE(IMathObject::parseFirst("1*)"));
+
+  EXPECT_EQ(IOperator::parseFirst("+").value()->getClass(), AddOper::getClassStatic());
+  EXPECT_EQ(IConstant::parseFirst("E").value()->getClass(), E::getClassStatic());
+  EXPECT_FALSE(IConstant::parseFirst("e"));
 }
 
 TEST(ParserTests, registerTypeTest) {
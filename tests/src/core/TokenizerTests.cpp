@@ -3,11 +3,30 @@
 #include "fintamath/core/Tokenizer.hpp"
 
 using namespace fintamath;
+using namespace detail;
 
 TEST(TokenizerTests, tokenizeTest) {
-  // TODO: implement
+  EXPECT_EQ(Tokenizer::tokenize(""), TokenVector{});
+  EXPECT_EQ(Tokenizer::tokenize(" \t\r\n "), TokenVector{});
+
+  EXPECT_EQ(Tokenizer::tokenize("12.5"), TokenVector({"12.5"}));
+  EXPECT_EQ(Tokenizer::tokenize("12 .5"), TokenVector({"12", ".5"}));
+  EXPECT_EQ(Tokenizer::tokenize("abc"), TokenVector({"a", "b", "c"}));
+  EXPECT_EQ(Tokenizer::tokenize("sin(x)+12.5  *\n\tcos2"), TokenVector({"sin", "(", "x", ")", "+", "12.5", "*", "cos", "2"}));
+  EXPECT_EQ(Tokenizer::tokenize("x>=1"), TokenVector({"x", ">=", "1"}));
+  EXPECT_EQ(Tokenizer::tokenize("x!=!"), TokenVector({"x", "!=", "!"}));
+  EXPECT_EQ(Tokenizer::tokenize("sinsin x"), TokenVector({"sin", "sin", "x"}));
+  EXPECT_EQ(Tokenizer::tokenize("si n"), TokenVector({"s", "i", "n"}));
 }
 
 TEST(TokenizerTests, registerTokenTest) {
-  // TODO: implement
+  EXPECT_EQ(Tokenizer::tokenize("#$#$"), TokenVector({"#", "$", "#", "$"}));
+
+  Tokenizer::registerToken("#$#");
+  EXPECT_EQ(Tokenizer::tokenize("#$#$"), TokenVector({"#$#", "$"}));
+  EXPECT_EQ(Tokenizer::tokenize("#$#1$"), TokenVector({"#$#", "1", "$"}));
+  EXPECT_EQ(Tokenizer::tokenize("#$1#$"), TokenVector({"#", "$", "1", "#", "$"}));
+
+  Tokenizer::registerToken("#$#$");
+  EXPECT_EQ(Tokenizer::tokenize("#$#$#$#"), TokenVector({"#$#$", "#$#"}));
 }
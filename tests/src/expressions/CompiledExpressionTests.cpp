@@ -0,0 +1,212 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "fintamath/expressions/CompiledExpression.hpp"
+
+#include "fintamath/exceptions/InvalidInputException.hpp"
+#include "fintamath/exceptions/UndefinedException.hpp"
+#include "fintamath/expressions/Expression.hpp"
+#include "fintamath/expressions/ExpressionFunctions.hpp"
+#include "fintamath/numbers/Rational.hpp"
+
+using namespace fintamath;
+
+using Operation = CompiledExpression::Operation;
+
+TEST(CompiledExpressionTests, constructorTest) {
+  const CompiledExpression compiled(Expression("y^2 + 2x"));
+
+  EXPECT_EQ(compiled.getVariables(), std::vector({Variable("x"), Variable("y")}));
+  EXPECT_EQ(compiled.getConstants().size(), 2);
+  EXPECT_EQ(compiled.getInstructions().size(), 7);
+  EXPECT_EQ(compiled.getInstructions().back().operation, Operation::Add);
+  EXPECT_EQ(compiled.getInstructions().back().argument, 2);
+  EXPECT_EQ(compiled.getMaxStackSize(), 3);
+
+  const CompiledExpression compiledBound(Expression("y^2 + 2x"), {Variable("y"), Variable("x"), Variable("z")});
+  EXPECT_EQ(compiledBound.getVariables(), std::vector({Variable("y"), Variable("x"), Variable("z")}));
+
+  EXPECT_TRUE(CompiledExpression(Expression("2")).getVariables().empty());
+}
+
+TEST(CompiledExpressionTests, evaluateTest) {
+  EXPECT_EQ(CompiledExpression(Expression("2/3")).evaluate({}).toString(), "0.66666666666666666667");
+  EXPECT_EQ(CompiledExpression(Expression("x")).evaluate({Real(5)}).toString(), "5.0");
+  EXPECT_EQ(CompiledExpression(Expression("y^2 + 2x")).evaluate({Real(1), Real(3)}).toString(), "11.0");
+  EXPECT_EQ(CompiledExpression(Expression("x - y")).evaluate({Real(1), Real(3)}).toString(), "-2.0");
+  EXPECT_EQ(CompiledExpression(Expression("x / y")).evaluate({Real(1), Real(3)}).toString(), "0.33333333333333333333");
+  EXPECT_EQ(CompiledExpression(Expression("sqrt(x) + E")).evaluate({Real(2)}).toString(), "4.1324953908321402842");
+  EXPECT_EQ(CompiledExpression(Expression("sin(x)^2 + cos(y) + Pi")).evaluate({Real(1), Real(2)}).toString(), "3.433519235316222045");
+  EXPECT_EQ(CompiledExpression(Expression("ln(x) + lb(x) + lg(x) + log(3, x)")).evaluate({Real(5)}).toString(), "6.0953095323754086945");
+  EXPECT_EQ(CompiledExpression(Expression("asinh(x) + atan(x) + sech(x) + acot(x)")).evaluate({Real(2)}).toString(), "3.2802340308077866538");
+  EXPECT_EQ(CompiledExpression(Expression("floor(x) + ceil(x) + abs(x) + x!")).evaluate({Real(Rational(-5, 2))}).toString(), "-0.13672819879264529694");
+  EXPECT_EQ(CompiledExpression(Expression("x^y")).evaluate({Real(-2), Real(3)}).toString(), "-8.0");
+}
+
+TEST(CompiledExpressionTests, evaluatePrecisionTest) {
+  const CompiledExpression compiled(Expression("sin(x) + Pi/3"));
+
+  EXPECT_EQ(compiled.evaluate({Real(1)}, 10).toString(), "1.888668536");
+  {
+    const Real::ScopedSetPrecision setPrecision(30);
+    EXPECT_EQ(compiled.evaluate({Real(1)}, 30).toString(), "1.88866853600449425280671678272");
+  }
+  EXPECT_EQ(compiled.evaluate({Real(1)}, 10).toString(), "1.888668536");
+
+  // The least precise input limits the result of both double and MPFR evaluation
+  Real value = 1;
+  value.setPrecision(5);
+  EXPECT_EQ(compiled.evaluate({value}, 10).toString(), "1.8887");
+  EXPECT_EQ(compiled.evaluate({value}, 30).toString(), "1.8887");
+}
+
+TEST(CompiledExpressionTests, evaluateCertifiedTest) {
+  const CompiledExpression compiled(Expression("sin(x) + Pi/3"));
+
+  EXPECT_EQ(compiled.evaluateCertified({Real(1)}, 10)->toString(), "1.888668536");
+  EXPECT_EQ(compiled.evaluateCertified({Real(1)}, 30)->toString(), "1.88866853600449425280671678272");
+
+  // Digits lost to the cancellation and to the argument reduction are recovered with more precision
+  EXPECT_EQ(CompiledExpression(Expression("sqrt(10^40 + 1) - 10^20")).evaluateCertified({}, 20)->toString(), "5.0*10^-21");
+  EXPECT_EQ(CompiledExpression(Expression("sin(10^40 E)")).evaluateCertified({}, 20)->toString(), "-0.98577112928406149203");
+
+  EXPECT_FALSE(CompiledExpression(Expression("sin(10^1000)")).evaluateCertified({}, 10));
+  EXPECT_FALSE(CompiledExpression(Expression("ln(x)")).evaluateCertified({Real(-1)}, 10));
+  EXPECT_FALSE(CompiledExpression(Expression("1/x")).evaluateCertified({Real(0)}, 10));
+  EXPECT_FALSE(CompiledExpression(Expression("x!")).evaluateCertified({Real(2)}, 10));
+
+  EXPECT_THAT(
+      [] { CompiledExpression(Expression("x + y")).evaluateCertified({Real(1)}); },
+      testing::ThrowsMessage<InvalidInputException>(
+          testing::StrEq(R"(Unable to evaluate "x + y" with 1 values (expected 2))")));
+}
+
+TEST(CompiledExpressionTests, evaluateDoublePrecisionTest) {
+  const std::vector<std::string> strs = {
+      "sin(x)^2 + cos(x) - Pi/3",
+      "x^3 - 2x/7 + E^x",
+      "ln(x) + lb(x) - lg(x)/3 + log(3, x)",
+      "sqrt(x) * atan(x) + 1/x",
+  };
+
+  for (const auto &str : strs) {
+    const Expression expr(str);
+    const CompiledExpression compiled(expr);
+
+    for (const unsigned precision : {1U, 5U, 10U, 15U}) {
+      for (const Rational &value : {Rational(1, 3), Rational(5, 2), Rational(1000), Rational(1, 1000)}) {
+        Expression exprWithValue = expr;
+        exprWithValue.setVariable(Variable("x"), Real(value));
+
+        EXPECT_EQ(compiled.evaluate({Real(value)}, precision).toString(), approximate(exprWithValue, precision).toString())
+            << str << " at x = " << value.toString() << " and precision " << precision;
+      }
+    }
+  }
+
+  // The cancellation is detected and the value is evaluated in MPFR
+  EXPECT_EQ(CompiledExpression(Expression("x - 1")).evaluate({Real("1.000000000000001")}, 10).toString(), "1.0*10^-15");
+  EXPECT_EQ(CompiledExpression(Expression("(x - 1) * 10^20")).evaluate({Real("1.00000000000000000001")}, 10).toString(), "1.0");
+
+  // The backend keeps at most the digits of a double instead of the calculation precision
+  EXPECT_LE(CompiledExpression(Expression("x/3")).evaluate({Real(1)}, 10).getBackend().precision(), std::numeric_limits<double>::digits10 + 1);
+}
+
+TEST(CompiledExpressionTests, evaluateNegativeTest) {
+  EXPECT_THAT(
+      [] { CompiledExpression(Expression("ln(x)")).evaluate({Real(-1)}); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq(R"(ln(x) is undefined for the given values)")));
+  EXPECT_THAT(
+      [] { CompiledExpression(Expression("1/x")).evaluate({Real(0)}); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq(R"(1/x is undefined for the given values)")));
+  EXPECT_THAT(
+      [] { CompiledExpression(Expression("x + y")).evaluate({Real(1)}); },
+      testing::ThrowsMessage<InvalidInputException>(
+          testing::StrEq(R"(Unable to evaluate "x + y" with 1 values (expected 2))")));
+}
+
+TEST(CompiledExpressionTests, evaluateBatchTest) {
+  const CompiledExpression compiled(Expression("sin(x)^2 + x y - ln(y)/3"));
+
+  std::vector<double> xs;
+  std::vector<double> ys;
+
+  for (size_t i = 0; i < 1000; i++) {
+    xs.emplace_back(static_cast<double>(i) / 100 - 5);
+    ys.emplace_back(static_cast<double>(i) / 250);
+  }
+
+  const auto res = compiled.evaluateBatch({xs, ys});
+  ASSERT_EQ(res.values.size(), 1000);
+  ASSERT_EQ(res.undefinedMask.size(), 1000);
+
+  EXPECT_EQ(res.undefinedMask[0], 1);
+  EXPECT_TRUE(std::isnan(res.values[0]));
+
+  for (size_t i = 1; i < 1000; i++) {
+    const double expected = std::sin(xs[i]) * std::sin(xs[i]) + xs[i] * ys[i] - std::log(ys[i]) / 3;
+    EXPECT_EQ(res.undefinedMask[i], 0);
+    EXPECT_NEAR(res.values[i], expected, 1e-12);
+  }
+
+  const auto constRes = CompiledExpression(Expression("Pi/2 + 1/3")).evaluateBatch({});
+  ASSERT_EQ(constRes.values.size(), 1);
+  EXPECT_NEAR(constRes.values.front(), std::acos(-1.0) / 2 + 1.0 / 3, 1e-15);
+  EXPECT_EQ(constRes.undefinedMask, std::vector<uint8_t>({0}));
+}
+
+TEST(CompiledExpressionTests, evaluateBatchUndefinedTest) {
+  const auto undefinedMask = [](const std::string &str, const std::vector<double> &xs) {
+    return CompiledExpression(Expression(str)).evaluateBatch({xs}).undefinedMask;
+  };
+
+  EXPECT_EQ(undefinedMask("1/x", {-1, 0, 1}), std::vector<uint8_t>({0, 1, 0}));
+  EXPECT_EQ(undefinedMask("x^x", {0, 1}), std::vector<uint8_t>({1, 0}));
+  EXPECT_EQ(undefinedMask("sqrt(x)", {-1, 0, 1}), std::vector<uint8_t>({1, 0, 0}));
+  EXPECT_EQ(undefinedMask("ln(x)", {-1, 0, 1}), std::vector<uint8_t>({1, 1, 0}));
+  EXPECT_EQ(undefinedMask("acot(x)", {-1, 0, 1}), std::vector<uint8_t>({0, 1, 0}));
+  EXPECT_EQ(undefinedMask("asin(x)", {-2, 0, 1}), std::vector<uint8_t>({1, 0, 0}));
+  EXPECT_EQ(undefinedMask("atanh(x)", {-1, 0, 1}), std::vector<uint8_t>({1, 0, 1}));
+  EXPECT_EQ(undefinedMask("x!", {-2, -1, -0.5, 0}), std::vector<uint8_t>({1, 1, 0, 0}));
+  EXPECT_EQ(undefinedMask("E^x", {1, 1000}), std::vector<uint8_t>({0, 1}));
+  EXPECT_EQ(undefinedMask("x", {1, NAN, INFINITY}), std::vector<uint8_t>({0, 1, 1}));
+}
+
+TEST(CompiledExpressionTests, evaluateBatchNegativeTest) {
+  EXPECT_THAT(
+      [] { CompiledExpression(Expression("x + y")).evaluateBatch({{1}}); },
+      testing::ThrowsMessage<InvalidInputException>(
+          testing::StrEq(R"(Unable to evaluate "x + y" with 1 columns (expected 2))")));
+  EXPECT_THAT(
+      [] { CompiledExpression(Expression("x + y")).evaluateBatch({{1}, {1, 2}}); },
+      testing::ThrowsMessage<InvalidInputException>(
+          testing::StrEq(R"(Unable to evaluate "x + y" with columns of different sizes)")));
+}
+
+TEST(CompiledExpressionTests, compileNegativeTest) {
+  EXPECT_THAT(
+      [] { CompiledExpression(Expression("x + y"), {Variable("x")}); },
+      testing::ThrowsMessage<InvalidInputException>(
+          testing::StrEq(R"(Unable to compile "x + y" (variable y is not bound))")));
+  EXPECT_THAT(
+      [] { CompiledExpression(Expression("x = 1")); },
+      testing::ThrowsMessage<InvalidInputException>(
+          testing::StrEq(R"(Unable to compile "x - 1 = 0" (x - 1 = 0 is not supported))")));
+  EXPECT_THAT(
+      [] { CompiledExpression(Expression("x + I")); },
+      testing::ThrowsMessage<InvalidInputException>(
+          testing::StrEq(R"(Unable to compile "x + I" (I is not supported))")));
+  EXPECT_THAT(
+      [] { CompiledExpression(Expression("(x)!!")); },
+      testing::ThrowsMessage<InvalidInputException>(
+          testing::StrEq(R"(Unable to compile "x!!" (x!! is not supported))")));
+}
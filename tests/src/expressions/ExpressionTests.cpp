@@ -34,6 +34,9 @@ TEST(ExpressionTests, stringConstructorTest) {
   EXPECT_EQ(Expression(" 2 + 2 ").toString(), "4");
   EXPECT_EQ(Expression("-2 + 3").toString(), "1");
   EXPECT_EQ(Expression("sqrt144").toString(), "12");
+  EXPECT_EQ(Expression("0012").toString(), "12");
+  EXPECT_EQ(Expression("1.5").toString(), "3/2");
+  EXPECT_EQ(Expression(".5 + 2.").toString(), "5/2");
 }
 
 TEST(ExpressionTests, stringConstructorNegativeTest) {
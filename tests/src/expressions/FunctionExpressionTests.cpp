@@ -1,6 +1,9 @@
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "fintamath/expressions/Expression.hpp"
+#include "fintamath/core/Tokenizer.hpp"
+#include "fintamath/exceptions/InvalidInputException.hpp"
 #include "fintamath/expressions/ExpressionUtils.hpp"
 #include "fintamath/functions/arithmetic/Abs.hpp"
 
@@ -61,6 +64,23 @@ protected:
 
 FINTAMATH_CLASS_IMPLEMENTATION(TestBinaryOperator)
 
+// Registered in a test after its name is parsed
+class TestLateFunction : public IFunctionCRTP<INumber, TestLateFunction, INumber> {
+  FINTAMATH_CLASS_BODY(TestLateFunction, IFunction)
+
+public:
+  std::string toString() const override {
+    return "testlatefunction";
+  }
+
+protected:
+  std::unique_ptr<IMathObject> call(const ArgumentRefVector &argVect) const override {
+    return std::make_unique<Integer>(1);
+  }
+};
+
+FINTAMATH_CLASS_IMPLEMENTATION(TestLateFunction)
+
 class TestUnaryPrefixOperator : public IOperatorCRTP<INumber, TestUnaryPrefixOperator, INumber> {
   FINTAMATH_CLASS_BODY(TestUnaryPrefixOperator, IOperator)
 
@@ -135,6 +155,19 @@ TEST(FunctionExpressionTests, stringConstructorTest) {
   EXPECT_EQ(Expression("testfunction(a+1,b+1)").toString(), "testfunction(a + 1, b + 1)");
 }
 
+TEST(FunctionExpressionTests, registerAfterParsingTest) {
+  // The name is already a token, but not a function yet
+  Tokenizer::registerToken("testlatefunction");
+  EXPECT_THAT(
+      [] { Expression("testlatefunction(a)"); },
+      testing::ThrowsMessage<InvalidInputException>(
+          testing::StrEq("Unable to parse an expression from \"testlatefunction(a)\" (invalid term \"testlatefunction\")")));
+
+  IFunction::registerType<TestLateFunction>();
+
+  EXPECT_EQ(Expression("testlatefunction(a)").toString(), "testlatefunction(a)");
+}
+
 TEST(FunctionExpressionTests, getClassTest) {
   auto expr = makeExpr(TestBinaryOperator(), Integer(0), Integer(0));
   EXPECT_EQ(expr->getClass()->getName(), "FunctionExpression");
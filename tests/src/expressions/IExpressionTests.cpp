@@ -8,6 +8,7 @@
 #include "fintamath/functions/arithmetic/Add.hpp"
 #include "fintamath/functions/other/Factorial.hpp"
 #include "fintamath/functions/trigonometry/Sin.hpp"
+#include "fintamath/numbers/Rational.hpp"
 
 using namespace fintamath;
 
@@ -100,6 +101,46 @@ TEST(IExpressionTests, toMinimalObjectTest) {
   // TODO: implement more tests
 }
 
+TEST(IExpressionTests, getHashTest) {
+  const auto expr1 = cast<IExpression>(parseRawExpr("sin(x)^2 + ln(y)"));
+  const auto expr2 = cast<IExpression>(parseRawExpr("sin(x)^2 + ln(y)"));
+  const auto expr3 = cast<IExpression>(parseRawExpr("sin(x)^2 + ln(z)"));
+  const auto expr4 = cast<IExpression>(parseRawExpr("sin(x)^2 - ln(y)"));
+  EXPECT_EQ(expr1->getHash(), expr2->getHash());
+  EXPECT_NE(expr1->getHash(), expr3->getHash());
+  EXPECT_NE(expr1->getHash(), expr4->getHash());
+
+  const auto intExpr = cast<IExpression>(sinExpr(Integer(2).clone()));
+  const auto rationalExpr = cast<IExpression>(sinExpr(Rational(4, 2).clone()));
+  EXPECT_EQ(*intExpr, *rationalExpr);
+  EXPECT_EQ(intExpr->getHash(), rationalExpr->getHash());
+
+  const auto otherIntExpr = cast<IExpression>(sinExpr(Integer(3).clone()));
+  const auto otherRationalExpr = cast<IExpression>(sinExpr(Rational(1, 2).clone()));
+  EXPECT_NE(intExpr->getHash(), otherIntExpr->getHash());
+  EXPECT_NE(intExpr->getHash(), otherRationalExpr->getHash());
+
+  const auto expr5 = cast<IExpression>(expr1->clone());
+  expr5->setChildren({Variable("a").clone(), Variable("b").clone()});
+  EXPECT_NE(expr1->getHash(), expr5->getHash());
+}
+
+TEST(IExpressionTests, internChildTest) {
+  const ArgumentPtr var = Variable("x").clone();
+
+  const auto expr1 = cast<IExpression>(sinExpr(addExpr(var, Integer(1).clone())));
+  const auto expr2 = cast<IExpression>(sinExpr(addExpr(var, Integer(1).clone())));
+  EXPECT_EQ(expr1->getChildren().front(), expr2->getChildren().front());
+
+  const auto expr3 = cast<IExpression>(sinExpr(addExpr(var, Rational(2, 2).clone())));
+  EXPECT_EQ(*expr1, *expr3);
+  EXPECT_NE(expr1->getChildren().front(), expr3->getChildren().front());
+
+  const auto expr4 = cast<IExpression>(sinExpr(addExpr(var, Integer(2).clone())));
+  EXPECT_NE(*expr1, *expr4);
+  EXPECT_NE(expr1->getChildren().front(), expr4->getChildren().front());
+}
+
 TEST(IExpressionTests, getClassTest) {
   EXPECT_EQ(IExpression::getClassStatic()->getName(), "IExpression");
   EXPECT_EQ(IExpression::getClassStatic()->getParent(), IMathObject::getClassStatic());
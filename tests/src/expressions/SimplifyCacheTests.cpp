@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include "fintamath/expressions/SimplifyCache.hpp"
+
+#include "fintamath/expressions/Expression.hpp"
+#include "fintamath/expressions/ExpressionFunctions.hpp"
+
+using namespace fintamath;
+
+TEST(SimplifyCacheTests, setCapacityTest) {
+  EXPECT_EQ(SimplifyCache::getCapacity(), 0);
+
+  SimplifyCache::setCapacity(2);
+  EXPECT_EQ(SimplifyCache::getCapacity(), 2);
+
+  (void)Expression("sin(x)^2 + cos(x)^2 + ln(y)*ln(y) + (a+b)^2").toString();
+  EXPECT_EQ(SimplifyCache::getStatistics().size, 2);
+  EXPECT_EQ(SimplifyCache::getStatistics().capacity, 2);
+
+  SimplifyCache::setCapacity(1);
+  EXPECT_EQ(SimplifyCache::getStatistics().size, 1);
+
+  SimplifyCache::setCapacity(0);
+  EXPECT_EQ(SimplifyCache::getStatistics().size, 0);
+
+  SimplifyCache::clear();
+}
+
+TEST(SimplifyCacheTests, clearTest) {
+  SimplifyCache::setCapacity(100);
+
+  (void)Expression("sin(x)^2 + cos(x)^2").toString();
+  EXPECT_GT(SimplifyCache::getStatistics().size, 0);
+  EXPECT_GT(SimplifyCache::getStatistics().misses, 0);
+
+  SimplifyCache::clear();
+  EXPECT_EQ(SimplifyCache::getStatistics().size, 0);
+  EXPECT_EQ(SimplifyCache::getStatistics().hits, 0);
+  EXPECT_EQ(SimplifyCache::getStatistics().misses, 0);
+
+  SimplifyCache::setCapacity(0);
+}
+
+TEST(SimplifyCacheTests, getStatisticsTest) {
+  SimplifyCache::setCapacity(1000);
+
+  const std::string str = "(x+1)^2/(x+1) + sin(x)^2 + cos(x)^2 + ln(2)*x";
+  const std::string expected = Expression(str).toString();
+  const size_t hits = SimplifyCache::getStatistics().hits;
+  const size_t misses = SimplifyCache::getStatistics().misses;
+
+  EXPECT_EQ(Expression(str).toString(), expected);
+  EXPECT_GT(SimplifyCache::getStatistics().hits, hits);
+  EXPECT_EQ(SimplifyCache::getStatistics().misses, misses);
+
+  SimplifyCache::setCapacity(0);
+  SimplifyCache::clear();
+}
+
+TEST(SimplifyCacheTests, simplifyTest) {
+  const std::vector<std::string> strs = {
+      "x^2 - 2x + 1 = 0",
+      "(a+b)^3",
+      "sqrt(8) + ln(E^2) + 1/(x-x)",
+      "sin(Pi/6) + cos(Pi/3) + tan(x)*cot(x)",
+      "derivative(x^2 sin(x), x)",
+      "1.5x + 2.5x",
+  };
+
+  std::vector<std::string> expected;
+
+  for (const auto &str : strs) {
+    expected.emplace_back(Expression(str).toString());
+  }
+
+  SimplifyCache::setCapacity(1000);
+
+  for (size_t i = 0; i < 2; i++) {
+    for (size_t j = 0; j < strs.size(); j++) {
+      EXPECT_EQ(Expression(strs[j]).toString(), expected[j]);
+      EXPECT_EQ(approximate(Expression(strs[j]), 5).toString(), approximate(Expression(expected[j]), 5).toString());
+    }
+  }
+
+  EXPECT_GT(SimplifyCache::getStatistics().hits, 0);
+
+  SimplifyCache::setCapacity(0);
+  SimplifyCache::clear();
+}
@@ -8,6 +8,7 @@
 #include "fintamath/numbers/Complex.hpp"
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
 
 using namespace fintamath;
 
@@ -45,6 +46,9 @@ TEST(SignTests, callTest) {
   EXPECT_EQ(f(Real(0))->toString(), "1");
   EXPECT_EQ(f(Real("1.23"))->toString(), "1");
 
+  EXPECT_EQ(f(RealBall(Real(-3), Real(2)))->toString(), "-1");
+  EXPECT_EQ(f(RealBall(Real(1), Real(2)))->toString(), "sign([1.0 +/- 2.0])");
+
   EXPECT_EQ(f(Complex(2, 0))->toString(), "1");
   EXPECT_EQ(f(Complex(0, 2))->toString(), "I");
   EXPECT_EQ(f(Complex(2, 2))->toString(), "((1 + I) sqrt(2))/2");
@@ -8,6 +8,7 @@
 #include "fintamath/numbers/Complex.hpp"
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
 
 using namespace fintamath;
 
@@ -54,6 +55,9 @@ TEST(FloorTests, callTest) {
   EXPECT_EQ(f(Real("2.2"))->toString(), "2");
   EXPECT_EQ(f(Real("2.9"))->toString(), "2");
 
+  EXPECT_EQ(f(RealBall(Real("2.5"), Real("0.1")))->toString(), "2");
+  EXPECT_EQ(f(RealBall(Real("3"), Real("0.1")))->toString(), "floor([3.0 +/- 0.1])");
+
   EXPECT_EQ(f(Complex(0, 0))->toString(), "0");
   EXPECT_EQ(f(Complex(2, 0))->toString(), "2");
   EXPECT_EQ(f(Complex(0, 2))->toString(), "2 I");
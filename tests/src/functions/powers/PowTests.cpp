@@ -8,6 +8,7 @@
 #include "fintamath/numbers/Complex.hpp"
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
 
 using namespace fintamath;
 
@@ -71,6 +72,10 @@ TEST(PowTests, callTest) {
             "32");
   EXPECT_EQ(f(Integer(16), Rational(5, 4))->toString(),
             "32");
+  EXPECT_EQ(f(Integer("12259964326927110850916040267783483001021757281745764351"), Rational(2, 3))->toString(),
+            "5316911983139663487003542222693990401");
+  EXPECT_EQ(f(Rational(Integer("12259964326927110850916040267783483001021757281745764351"), 8), Rational(4, 3))->toString(),
+            "28269553036454149224292902704178252817674109380037990394614044720680140801/16");
   EXPECT_EQ(f(Integer(7), Rational(3, 1000))->toString(),
             "root(343, 1000)");
   EXPECT_EQ(f(Integer(1), Rational(1, 1234))->toString(),
@@ -122,6 +127,11 @@ TEST(PowTests, callTest) {
   EXPECT_EQ(f(Real("2.2"), Real("0.5"))->toString(),
             "1.4832396974191325897");
 
+  EXPECT_EQ(f(RealBall(3), Integer(4))->toString(),
+            "81.0");
+  EXPECT_EQ(f(RealBall(2), Rational(1, 2))->toString(),
+            "[1.4142135623730950488 +/- 5.35*10^-51]");
+
   EXPECT_EQ(f(Integer(-10), Rational(1, 2))->toString(),
             "I sqrt(10)");
   EXPECT_EQ(f(Rational(-10), Real("-1.5"))->toString(),
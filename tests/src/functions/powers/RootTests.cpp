@@ -57,6 +57,8 @@ TEST(RootTests, callTest) {
             "2 sqrt(248047222222)");
   EXPECT_EQ(f(Integer("68732648273642987365932706179432649827364"), Integer(2))->toString(),
             "2 sqrt(17183162068410746841483176544858162456841)");
+  EXPECT_EQ(f(Integer("39614081238685424596360888379"), Integer(2))->toString(),
+            "sqrt(39614081238685424596360888379)");
   EXPECT_EQ(f(Integer(100), Integer(3))->toString(),
             "root(100, 3)");
   EXPECT_EQ(f(Integer(25), Integer(3))->toString(),
@@ -81,6 +83,12 @@ TEST(RootTests, callTest) {
             "4");
   EXPECT_EQ(f(Integer(1024), Integer(10))->toString(),
             "2");
+  EXPECT_EQ(f(Integer("12259964326927110850916040267783483001021757281745764351"), Integer(3))->toString(),
+            "2305843009213693951");
+  EXPECT_EQ(f(Integer("36779892980781332552748120803350449003065271845237293053"), Integer(3))->toString(),
+            "2305843009213693951 root(3, 3)");
+  EXPECT_EQ(f(Integer("150306725297525326193815850738296241612545406502344103658176804233959844026210264758829559272645143729222451201"), Integer(4))->toString(),
+            "2305843009213693951 sqrt(2305843009213693951)");
   EXPECT_EQ(f(Integer(-1000), Integer(3))->toString(),
             "root(-1000, 3)");
   EXPECT_EQ(f(Integer(-10), Integer(3))->toString(),
@@ -8,6 +8,7 @@
 #include "fintamath/numbers/Complex.hpp"
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealBall.hpp"
 
 using namespace fintamath;
 
@@ -42,6 +43,9 @@ TEST(SinTests, callTest) {
 
   EXPECT_EQ(f(Real("1.123"))->toString(), "0.90140343710581305144");
 
+  EXPECT_EQ(f(RealBall(10))->toString(), "[-0.5440211108893698134 +/- 2.67*10^-51]");
+  EXPECT_EQ(f(RealBall(Real(10), Real("0.001")))->toString(), "[-0.54 +/- 0.001]");
+
   EXPECT_EQ(f(Complex(1, 1))->toString(), "sin(1 + I)");
 
   EXPECT_EQ(f(Variable("a"))->toString(), "sin(a)");
@@ -0,0 +1,44 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "fintamath/numbers/ComplexFunctions.hpp"
+
+#include "fintamath/exceptions/UndefinedException.hpp"
+#include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/Real.hpp"
+
+using namespace fintamath;
+
+TEST(ComplexFunctionsTests, powTest) {
+  EXPECT_EQ(pow(Complex(5, 2), Integer(2)).toString(),
+            "21 + 20 I");
+  EXPECT_EQ(pow(Complex(Rational(1, 2), Rational(2, 3)), Integer(5)).toString(),
+            "-79/2592 - 779/1944 I");
+  EXPECT_EQ(pow(Complex(6789, 2345), Integer(4)).toString(),
+            "633857838549916 + 2584899750306720 I");
+  EXPECT_EQ(pow(Complex("135253468973498327423987498324729384.12987349823749832"), Integer(3)).toString(),
+            "4832537992678386348337867205980822373798257851094432575433371642956047093945525418683507600681355491343220122262032882136893556623485326120689398001084489/1953125000000000000000000000000000000000000000000");
+  EXPECT_EQ(pow(Complex(6789, 11), Integer(-4)).toString(),
+            "531075666086959/1128212841481282934557153710724 - 860496245400/282053210370320733639288427681 I");
+  EXPECT_EQ(pow(Complex(1, 1), Integer(100)).toString(),
+            "-1125899906842624");
+  EXPECT_EQ(pow(Complex(0, 1), Integer("429837493286275623874628734628735")).toString(),
+            "-I");
+  EXPECT_EQ(pow(Complex(0, 1), Integer(-1)).toString(),
+            "-I");
+  EXPECT_EQ(pow(Complex(2, 3), Integer(0)).toString(),
+            "1");
+  EXPECT_EQ(pow(Complex(2, 3), Integer(1)).toString(),
+            "2 + 3 I");
+  EXPECT_EQ(pow(Complex(Real("1.5"), Real("-2")), Integer(2)).toString(),
+            "-1.75 - 6.0 I");
+
+  EXPECT_THAT(
+      [] { pow(Complex(0), Integer(0)); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq(R"(pow(0, 0) is undefined (zero to the power of zero))")));
+  EXPECT_THAT(
+      [] { pow(Complex(Real(0)), Integer(0)); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq(R"(pow(0.0, 0) is undefined (zero to the power of zero))")));
+}
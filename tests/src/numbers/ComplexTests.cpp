@@ -36,6 +36,30 @@ TEST(ComplexTests, copyTest) {
   EXPECT_TRUE(a == b && &a != &b);
 }
 
+TEST(ComplexTests, partsTest) {
+  Complex a(Rational(1, 2), Integer(3));
+  EXPECT_TRUE(is<Rational>(a.real()));
+  EXPECT_TRUE(is<Integer>(a.imag()));
+
+  a *= 2;
+  EXPECT_TRUE(is<Integer>(a.real()));
+  EXPECT_EQ(a.toString(), "1 + 6 I");
+
+  a *= a;
+  EXPECT_EQ(a.toString(), "-35 + 12 I");
+
+  a /= a;
+  EXPECT_TRUE(is<Integer>(a.real()));
+  EXPECT_TRUE(is<Integer>(a.imag()));
+  EXPECT_EQ(a, 1);
+
+  Complex b(Real("1.5"), Rational(1, 3));
+  b += Complex(Rational(1, 2), Rational(2, 3));
+  EXPECT_TRUE(is<Real>(b.real()));
+  EXPECT_TRUE(is<Integer>(b.imag()));
+  EXPECT_EQ(b.toString(), "2.0 + I");
+}
+
 TEST(ComplexTests, stringConstructorTest) {
   EXPECT_EQ(Complex("0"), 0);
   EXPECT_EQ(Complex("1"), 1);
@@ -5,8 +5,10 @@
 #include "fintamath/numbers/IntegerFunctions.hpp"
 
 #include "fintamath/exceptions/UndefinedException.hpp"
+#include "fintamath/numbers/ComplexFunctions.hpp"
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
+#include "fintamath/numbers/RealFunctions.hpp"
 
 using namespace fintamath;
 
@@ -123,6 +125,117 @@ TEST(IntegerFunctionsTests, sqrtWithRemainderTest) {
           testing::StrEq(R"(sqrt(-9289) is undefined (expected argument >= 0))")));
 }
 
+TEST(IntegerFunctionsTests, rootTest) {
+  EXPECT_EQ(root(Integer(0), Integer(3)), 0);
+  EXPECT_EQ(root(Integer(1), Integer(3)), 1);
+  EXPECT_EQ(root(Integer(27), Integer(3)), 3);
+  EXPECT_EQ(root(Integer(100), Integer(3)), 4);
+  EXPECT_EQ(root(Integer(1024), Integer(10)), 2);
+  EXPECT_EQ(root(Integer(1023), Integer(10)), 1);
+  EXPECT_EQ(root(Integer(25), Integer(2)), 5);
+  EXPECT_EQ(root(Integer(-27), Integer(3)), -3);
+  EXPECT_EQ(root(Integer(-30), Integer(3)), -3);
+  EXPECT_EQ(root(Integer(5), Integer(1)), 5);
+  EXPECT_EQ(root(Integer(5), Integer(1000)), 1);
+  EXPECT_EQ(root(Integer(-5), Integer(1001)), -1);
+  EXPECT_EQ(root(Integer(5), Integer("100000000000000000000000000000")), 1);
+  EXPECT_EQ(root(Integer("12259964326927110850916040267783483001021757281745764351"), Integer(3)),
+            Integer("2305843009213693951"));
+  EXPECT_EQ(root(Integer("1000000000000000000000000000285000000000000000000000000032490000000000000000000000001851930000000000000000000000052780005000000000000000000000601692057"), Integer(5)),
+            Integer("1000000000000000000000000000057"));
+
+  EXPECT_THAT(
+      [] { root(Integer(-16), Integer(4)); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq(R"(root(-16, 4) is undefined (expected argument >= 0 for even degree))")));
+  EXPECT_THAT(
+      [] { root(Integer(16), Integer(0)); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq(R"(root(16, 0) is undefined (expected degree > 0))")));
+  EXPECT_THAT(
+      [] { root(Integer(16), Integer(-2)); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq(R"(root(16, -2) is undefined (expected degree > 0))")));
+}
+
+TEST(IntegerFunctionsTests, rootWithRemainderTest) {
+  Integer remainder;
+
+  EXPECT_EQ(root(Integer(0), Integer(3), remainder), 0);
+  EXPECT_EQ(remainder, 0);
+
+  EXPECT_EQ(root(Integer(27), Integer(3), remainder), 3);
+  EXPECT_EQ(remainder, 0);
+
+  EXPECT_EQ(root(Integer(100), Integer(3), remainder), 4);
+  EXPECT_EQ(remainder, 36);
+
+  EXPECT_EQ(root(Integer(-30), Integer(3), remainder), -3);
+  EXPECT_EQ(remainder, -3);
+
+  EXPECT_EQ(root(Integer(5), Integer(1000), remainder), 1);
+  EXPECT_EQ(remainder, 4);
+
+  EXPECT_EQ(root(Integer(-5), Integer(1001), remainder), -1);
+  EXPECT_EQ(remainder, -4);
+
+  EXPECT_EQ(root(Integer("12259964326927110850916040267783483001021757281745764351"), Integer(3), remainder),
+            Integer("2305843009213693951"));
+  EXPECT_EQ(remainder, 0);
+
+  EXPECT_EQ(root(Integer("12259964326927110850916040267783483001021757281745764352"), Integer(3), remainder),
+            Integer("2305843009213693951"));
+  EXPECT_EQ(remainder, 1);
+
+  EXPECT_THAT(
+      [&] { root(Integer(-16), Integer(4), remainder); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq(R"(root(-16, 4) is undefined (expected argument >= 0 for even degree))")));
+}
+
+TEST(IntegerFunctionsTests, isPerfectPowerTest) {
+  EXPECT_TRUE(isPerfectPower(Integer(0)));
+  EXPECT_TRUE(isPerfectPower(Integer(1)));
+  EXPECT_TRUE(isPerfectPower(Integer(4)));
+  EXPECT_TRUE(isPerfectPower(Integer(1024)));
+  EXPECT_TRUE(isPerfectPower(Integer(-8)));
+  EXPECT_TRUE(isPerfectPower(Integer("12259964326927110850916040267783483001021757281745764351")));
+
+  EXPECT_FALSE(isPerfectPower(Integer(2)));
+  EXPECT_FALSE(isPerfectPower(Integer(12)));
+  EXPECT_FALSE(isPerfectPower(Integer(-4)));
+  EXPECT_FALSE(isPerfectPower(Integer("12259964326927110850916040267783483001021757281745764352")));
+}
+
+TEST(IntegerFunctionsTests, perfectPowerBaseTest) {
+  Integer degree;
+
+  EXPECT_EQ(perfectPowerBase(Integer(1024), degree), 2);
+  EXPECT_EQ(degree, 10);
+
+  EXPECT_EQ(perfectPowerBase(Integer(36), degree), 6);
+  EXPECT_EQ(degree, 2);
+
+  EXPECT_EQ(perfectPowerBase(Integer(-32), degree), -2);
+  EXPECT_EQ(degree, 5);
+
+  EXPECT_EQ(perfectPowerBase(Integer(-64), degree), -4);
+  EXPECT_EQ(degree, 3);
+
+  EXPECT_EQ(perfectPowerBase(Integer(12), degree), 12);
+  EXPECT_EQ(degree, 1);
+
+  EXPECT_EQ(perfectPowerBase(Integer(1), degree), 1);
+  EXPECT_EQ(degree, 1);
+
+  EXPECT_EQ(perfectPowerBase(Integer(0), degree), 0);
+  EXPECT_EQ(degree, 1);
+
+  EXPECT_EQ(perfectPowerBase(Integer("150306725297525326193815850738296241612545406502344103658176804233959844026210264758829559272645143729222451201"), degree),
+            Integer("2305843009213693951"));
+  EXPECT_EQ(degree, 6);
+}
+
 TEST(IntegerFunctionsTests, powTest) {
   EXPECT_EQ(pow(Integer(5), Integer(2)),
             25);
@@ -136,6 +249,14 @@ TEST(IntegerFunctionsTests, powTest) {
             "2474259452251333810348988009462181048257185161014872437371075550103119323428971486869861741659206806895104");
   EXPECT_EQ(pow(Integer(6789), Integer(-4)),
             0);
+  EXPECT_EQ(pow(Integer(-1), Integer("429837493286275623874628734628735")),
+            -1);
+  EXPECT_EQ(pow(Integer(-1), Integer("429837493286275623874628734628734")),
+            1);
+  EXPECT_EQ(pow(Integer(0), Integer("429837493286275623874628734628734")),
+            0);
+  EXPECT_EQ(pow(Integer(2), Integer(100)).toString(),
+            "1267650600228229401496703205376");
 
   EXPECT_EQ(pow(Rational(5, 2), Integer(2)).toString(),
             "25/4");
@@ -173,19 +294,23 @@ TEST(IntegerFunctionsTests, powTest) {
   EXPECT_THAT(
       [] { pow(Integer(0), Integer(0)); },
       testing::ThrowsMessage<UndefinedException>(
-          testing::StrEq(R"(pow({}, {}) is undefined (zero to the power of zero))")));
+          testing::StrEq(R"(pow(0, 0) is undefined (zero to the power of zero))")));
+  EXPECT_THAT(
+      [] { pow(Integer(2), Integer("429837493286275623874628734628734")); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq(R"(pow(2, 429837493286275623874628734628734) is undefined (exponent is too large))")));
   EXPECT_THAT(
       [] { pow(Rational(0), Integer(0)); },
       testing::ThrowsMessage<UndefinedException>(
-          testing::StrEq(R"(pow({}, {}) is undefined (zero to the power of zero))")));
+          testing::StrEq(R"(pow(0, 0) is undefined (zero to the power of zero))")));
   EXPECT_THAT(
       [] { pow(Real(0), Integer(0)); },
       testing::ThrowsMessage<UndefinedException>(
-          testing::StrEq(R"(pow({}, {}) is undefined (zero to the power of zero))")));
+          testing::StrEq(R"(pow(0.0, 0) is undefined (zero to the power of zero))")));
   EXPECT_THAT(
       [] { pow(Complex(0), Integer(0)); },
       testing::ThrowsMessage<UndefinedException>(
-          testing::StrEq(R"(pow({}, {}) is undefined (zero to the power of zero))")));
+          testing::StrEq(R"(pow(0, 0) is undefined (zero to the power of zero))")));
 }
 
 TEST(IntegerFunctionsTests, factorialTest) {
@@ -197,6 +322,10 @@ TEST(IntegerFunctionsTests, factorialTest) {
   EXPECT_EQ(factorial(Integer(5)), 120);
   EXPECT_EQ(factorial(Integer(10)), 3628800);
   EXPECT_EQ(factorial(Integer(25)).toString(), "15511210043330985984000000");
+  EXPECT_EQ(factorial(Integer(255)), factorial(Integer(254)) * 255);
+  EXPECT_EQ(factorial(Integer(256)), factorial(Integer(255)) * 256);
+  EXPECT_EQ(factorial(Integer(300)).toString(), "306057512216440636035370461297268629388588804173576999416776741259476533176716867465515291422477573349939147888701726368864263907759003154226842927906974559841225476930271954604008012215776252176854255965356903506788725264321896264299365204576448830388909753943489625436053225980776521270822437639449120128678675368305712293681943649956460498166450227716500185176546469340112226034729724066333258583506870150169794168850353752137554910289126407157154830282284937952636580145235233156936482233436799254594095276820608062232812387383880817049600000000000000000000000000000000000000000000000000000000000000000000000000");
+  EXPECT_EQ(factorial(Integer(70000)), factorial(Integer(69999)) * 70000);
 
   EXPECT_THAT(
       [] { factorial(Integer(-1)); },
@@ -206,6 +335,10 @@ TEST(IntegerFunctionsTests, factorialTest) {
       [] { factorial(Integer(-2)); },
       testing::ThrowsMessage<UndefinedException>(
           testing::StrEq(R"(factorial(-2) is undefined (expected argument >= 0))")));
+  EXPECT_THAT(
+      [] { factorial(Integer("100000000000000000000")); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq(R"(factorial(100000000000000000000) is undefined (argument is too large))")));
 }
 
 TEST(IntegerFunctionsTests, nthFactorialTest) {
@@ -263,6 +396,21 @@ TEST(IntegerFunctionsTests, nthFactorialTest) {
           testing::StrEq(R"(factorial(-2, 20) is undefined (expected first argument >= 0))")));
 }
 
+TEST(IntegerFunctionsTests, isPrimeTest) {
+  EXPECT_FALSE(isPrime(-7));
+  EXPECT_FALSE(isPrime(0));
+  EXPECT_FALSE(isPrime(1));
+  EXPECT_TRUE(isPrime(2));
+  EXPECT_TRUE(isPrime(3));
+  EXPECT_FALSE(isPrime(4));
+  EXPECT_FALSE(isPrime(561));
+  EXPECT_TRUE(isPrime(65537));
+  EXPECT_TRUE(isPrime(Integer("18446744073709551557")));
+  EXPECT_TRUE(isPrime(Integer("170141183460469231731687303715884105727")));
+  EXPECT_FALSE(isPrime(Integer("998244359987710471")));
+  EXPECT_FALSE(isPrime(Integer("3825123056546413051")));
+}
+
 TEST(IntegerFunctionsTests, factorsTest) {
   FactorToCountMap factorToCountMap;
 
@@ -306,6 +454,36 @@ TEST(IntegerFunctionsTests, factorsTest) {
   EXPECT_EQ(factorToCountMap[59], 1);
   EXPECT_EQ(factorToCountMap[Integer("7406060776921378681")], 1);
 
+  factorToCountMap = factors(Integer("139826427468275632"));
+  EXPECT_EQ(factorToCountMap.size(), 6);
+  EXPECT_EQ(factorToCountMap[2], 4);
+  EXPECT_EQ(factorToCountMap[7], 1);
+  EXPECT_EQ(factorToCountMap[17], 1);
+  EXPECT_EQ(factorToCountMap[31], 1);
+  EXPECT_EQ(factorToCountMap[1093], 1);
+  EXPECT_EQ(factorToCountMap[Integer("2167406951")], 1);
+
+  factorToCountMap = factors(Integer("998244359987710471"));
+  EXPECT_EQ(factorToCountMap.size(), 2);
+  EXPECT_EQ(factorToCountMap[Integer("998244353")], 1);
+  EXPECT_EQ(factorToCountMap[Integer("1000000007")], 1);
+
+  factorToCountMap = factors(Integer("39614081238685424596360888379"));
+  EXPECT_EQ(factorToCountMap.size(), 2);
+  EXPECT_EQ(factorToCountMap[Integer("2147483647")], 1);
+  EXPECT_EQ(factorToCountMap[Integer("18446744073709551557")], 1);
+
+  factorToCountMap = factors(Integer("26584559915698317435017711113469952005"));
+  EXPECT_EQ(factorToCountMap.size(), 2);
+  EXPECT_EQ(factorToCountMap[5], 1);
+  EXPECT_EQ(factorToCountMap[Integer("2305843009213693951")], 2);
+
+  factorToCountMap = factors(Integer("1020847100762815390390123822295304634362"));
+  EXPECT_EQ(factorToCountMap.size(), 3);
+  EXPECT_EQ(factorToCountMap[2], 1);
+  EXPECT_EQ(factorToCountMap[3], 1);
+  EXPECT_EQ(factorToCountMap[Integer("170141183460469231731687303715884105727")], 1);
+
   EXPECT_THAT(
       [] { factors(-1); },
       testing::ThrowsMessage<UndefinedException>(
@@ -324,6 +502,13 @@ TEST(IntegerFunctionsTests, combinationsTest) {
   EXPECT_EQ(combinations(Integer(6), Integer(2)), 15);
   EXPECT_EQ(combinations(Integer(10), Integer(7)), 120);
   EXPECT_EQ(combinations(Integer(15), Integer(2)), 105);
+  EXPECT_EQ(combinations(Integer(6), Integer(0)), 1);
+  EXPECT_EQ(combinations(Integer(70), Integer(50)), Integer("161884603662657876"));
+  EXPECT_EQ(combinations(Integer(200), Integer(50)), Integer("453858377923246061067441390280868162761998660528"));
+  EXPECT_EQ(combinations(Integer(1000), Integer(500)).toString(),
+            "270288240945436569515614693625975275496152008446548287007392875106625428705522193898612483924502370165362606085021546104802209750050679917549894219699518475423665484263751733356162464079737887344364574161119497604571044985756287880514600994219426752366915856603136862602484428109296905863799821216320");
+  EXPECT_EQ(combinations(Integer("100000000000000000000"), Integer(3)).toString(),
+            "166666666666666666661666666666666666666700000000000000000000");
 
   EXPECT_THAT(
       [] { combinations(Integer(20), Integer(40)); },
@@ -345,4 +530,15 @@ TEST(IntegerFunctionsTests, multinomialCoefficientTest) {
   EXPECT_EQ(multinomialCoefficient({Integer(8)}), 1);
   EXPECT_EQ(multinomialCoefficient({Integer(3), Integer(2)}), 10);
   EXPECT_EQ(multinomialCoefficient({Integer(3), Integer(9), Integer(0)}), 220);
+  EXPECT_EQ(multinomialCoefficient({}), 1);
+  EXPECT_EQ(multinomialCoefficient({Integer(20), Integer(50)}), Integer("161884603662657876"));
+  EXPECT_EQ(multinomialCoefficient({Integer(100), Integer(100), Integer(100)}).toString(),
+            "376523493564631064367712071965768747782444205128669798396168767743500485766630075466163294008566118208045715304490994009624725072511252178400");
+  EXPECT_EQ(multinomialCoefficient({Integer("4294967296"), Integer(1)}).toString(),
+            "4294967297");
+
+  EXPECT_THAT(
+      [] { multinomialCoefficient({Integer(2), Integer(-1)}); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq(R"(multinomialCoefficient is undefined (expected group numbers >= 0, got -1))")));
 }
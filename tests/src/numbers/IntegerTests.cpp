@@ -3,6 +3,8 @@
 
 #include "fintamath/numbers/Integer.hpp"
 
+#include <cstdint>
+#include <limits>
 #include <unordered_set>
 
 #include "fintamath/exceptions/InvalidInputException.hpp"
@@ -607,12 +609,66 @@ TEST(IntegerTests, signTest) {
   EXPECT_EQ(Integer(2).sign(), 1);
 }
 
+TEST(IntegerTests, getLargeBackendTest) {
+  EXPECT_FALSE(Integer(-2).getLargeBackend());
+  EXPECT_FALSE(Integer(std::numeric_limits<int64_t>::max()).getLargeBackend());
+
+  const Integer large("100000000000000000000");
+  ASSERT_TRUE(large.getLargeBackend());
+  EXPECT_EQ(*large.getLargeBackend(), large.getBackend());
+}
+
 TEST(IntegerTests, intOperatorTest) {
   EXPECT_EQ(static_cast<int64_t>(Integer(-2)), -2);
   EXPECT_EQ(static_cast<int64_t>(Integer(10)), 10);
   EXPECT_EQ(static_cast<int64_t>(Integer(0)), 0);
   EXPECT_EQ(static_cast<int64_t>(Integer("100000000000000000000000000000000000000000000000000")), 9223372036854775807);
   EXPECT_EQ(static_cast<int64_t>(Integer("-100000000000000000000000000000000000000000000000000")) + 1, -9223372036854775807);
+  EXPECT_EQ(static_cast<uint64_t>(Integer("18446744073709551615")), 18446744073709551615U);
+  EXPECT_EQ(static_cast<int32_t>(Integer(10000000000)), 2147483647);
+  EXPECT_EQ(static_cast<int32_t>(Integer(-10000000000)), -2147483648);
+}
+
+TEST(IntegerTests, int64BoundaryTest) {
+  const Integer max(std::numeric_limits<int64_t>::max());
+  const Integer min(std::numeric_limits<int64_t>::min());
+
+  EXPECT_EQ(Integer(std::numeric_limits<uint64_t>::max()).toString(), "18446744073709551615");
+  EXPECT_EQ(Integer("9223372036854775807"), max);
+  EXPECT_EQ(Integer("-9223372036854775808"), min);
+  EXPECT_EQ(Integer("9223372036854775808").toString(), "9223372036854775808");
+  EXPECT_EQ(Integer("-9223372036854775809").toString(), "-9223372036854775809");
+
+  EXPECT_EQ((max + 1).toString(), "9223372036854775808");
+  EXPECT_EQ((min - 1).toString(), "-9223372036854775809");
+  EXPECT_EQ((max * 2).toString(), "18446744073709551614");
+  EXPECT_EQ((min * -1).toString(), "9223372036854775808");
+  EXPECT_EQ((min / -1).toString(), "9223372036854775808");
+  EXPECT_EQ(min % -1, 0);
+  EXPECT_EQ((-min).toString(), "9223372036854775808");
+  EXPECT_EQ((Integer(1) << 63).toString(), "9223372036854775808");
+  EXPECT_EQ((Integer(-1) << 63), min);
+  EXPECT_EQ((Integer(3) << 100).toString(), "3802951800684688204490109616128");
+  EXPECT_EQ(Integer(-5) >> 100, -1);
+  EXPECT_EQ(Integer(5) >> 100, 0);
+
+  Integer val = max;
+  EXPECT_EQ((++val).toString(), "9223372036854775808");
+  EXPECT_EQ(--val, max);
+  val = min;
+  EXPECT_EQ((--val).toString(), "-9223372036854775809");
+  EXPECT_EQ(++val, min);
+
+  EXPECT_EQ(max + 1 - 1, max);
+  EXPECT_EQ((max + 1) * (max + 1) / (max + 1) - 1, max);
+  EXPECT_EQ(min - 1 + 1, min);
+
+  EXPECT_LT(min - 1, min);
+  EXPECT_LT(min, max);
+  EXPECT_LT(max, max + 1);
+  EXPECT_LT(min - 1, max + 1);
+  EXPECT_GT(max + 1, 0);
+  EXPECT_LT(min - 1, 0);
 }
 
 TEST(IntegerTests, getPrecisionTest) {
@@ -658,4 +714,8 @@ TEST(IntegerTests, hashTest) {
   EXPECT_NE(hasher(Integer(-12)), hasher(Integer(-13)));
   EXPECT_NE(hasher(Integer("452734865298734659873246238756987435")), hasher(Integer("452734865298734659873246238756987436")));
   EXPECT_NE(hasher(Integer("-452734865298734659873246238756987435")), hasher(Integer("-452734865298734659873246238756987436")));
+
+  const Integer max(std::numeric_limits<int64_t>::max());
+  EXPECT_EQ(hasher(max + 1 - 1), hasher(max));
+  EXPECT_EQ(hasher(Integer("9223372036854775808") - 1), hasher(max));
 }
@@ -1,7 +1,10 @@
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "fintamath/numbers/RationalFunctions.hpp"
 
+#include "fintamath/exceptions/UndefinedException.hpp"
+
 using namespace fintamath;
 
 TEST(RationalFunctionsTests, floorTest) {
@@ -54,3 +57,52 @@ TEST(RationalFunctionsTests, absTest) {
   EXPECT_EQ(abs(Rational(10, 1000)).toString(), "1/100");
   EXPECT_EQ(abs(Rational(0)).toString(), "0");
 }
+
+TEST(RationalFunctionsTests, powTest) {
+  EXPECT_EQ(pow(Rational(5, 2), Integer(2)).toString(),
+            "25/4");
+  EXPECT_EQ(pow(Rational(-5, 2), Integer(5)).toString(),
+            "-3125/32");
+  EXPECT_EQ(pow(Rational(6789), Integer(4)).toString(),
+            "2124336126051441");
+  EXPECT_EQ(pow(Rational("135253468973498327423987498324729384.12987349823749832"), Integer(3)).toString(),
+            "4832537992678386348337867205980822373798257851094432575433371642956047093945525418683507600681355491343220122262032882136893556623485326120689398001084489/1953125000000000000000000000000000000000000000000");
+  EXPECT_EQ(pow(Rational(6789), Integer(-4)).toString(),
+            "1/2124336126051441");
+  EXPECT_EQ(pow(Rational(-2, 3), Integer(-3)).toString(),
+            "-27/8");
+  EXPECT_EQ(pow(Rational(-1, 1), Integer("429837493286275623874628734628735")).toString(),
+            "-1");
+  EXPECT_EQ(pow(Rational(0), Integer(5)).toString(),
+            "0");
+  EXPECT_EQ(pow(Rational(7, 9), Integer(0)).toString(),
+            "1");
+
+  EXPECT_THAT(
+      [] { pow(Rational(0), Integer(0)); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq(R"(pow(0, 0) is undefined (zero to the power of zero))")));
+  EXPECT_THAT(
+      [] { pow(Rational(0), Integer(-1)); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq(R"(div(1, 0) is undefined (division by zero))")));
+}
+
+TEST(RationalFunctionsTests, perfectRootTest) {
+  EXPECT_EQ(perfectRoot(Rational(0), Integer(3))->toString(), "0");
+  EXPECT_EQ(perfectRoot(Rational(8, 27), Integer(3))->toString(), "2/3");
+  EXPECT_EQ(perfectRoot(Rational(-8, 27), Integer(3))->toString(), "-2/3");
+  EXPECT_EQ(perfectRoot(Rational(16, 81), Integer(4))->toString(), "2/3");
+  EXPECT_EQ(perfectRoot(Rational(5), Integer(1))->toString(), "5");
+  EXPECT_EQ(perfectRoot(Rational(Integer("12259964326927110850916040267783483001021757281745764351"), 1000), Integer(3))->toString(),
+            "2305843009213693951/10");
+
+  EXPECT_FALSE(perfectRoot(Rational(2), Integer(2)));
+  EXPECT_FALSE(perfectRoot(Rational(8, 9), Integer(3)));
+  EXPECT_FALSE(perfectRoot(Rational(9, 8), Integer(3)));
+
+  EXPECT_THAT(
+      [] { perfectRoot(Rational(-1, 4), Integer(2)); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq(R"(root(-1, 2) is undefined (expected argument >= 0 for even degree))")));
+}
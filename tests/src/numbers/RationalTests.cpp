@@ -1,6 +1,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <limits>
 #include <unordered_set>
 
 #include "fintamath/exceptions/InvalidInputException.hpp"
@@ -548,6 +550,59 @@ TEST(RationalTests, simplifyTest) {
   EXPECT_EQ(Rational(-55, 5).toMinimalObject()->toString(), "-11");
 }
 
+TEST(RationalTests, arithmeticReductionTest) {
+  EXPECT_EQ(Rational(1, 6) + Rational(1, 3), Rational(1, 2));
+  EXPECT_EQ((Rational(1, 6) + Rational(1, 3)).denominator(), 2);
+  EXPECT_EQ(Rational(1, 6) + Rational(-1, 6), 0);
+  EXPECT_EQ((Rational(1, 6) + Rational(5, 6)).denominator(), 1);
+  EXPECT_EQ((Rational(1, 6) - Rational(2, 3)).toString(), "-1/2");
+  EXPECT_EQ((Rational(1, 4) + Rational(3, 10)).toString(), "11/20");
+  EXPECT_EQ((Rational(7, 12) + Rational(5, 18)).toString(), "31/36");
+  EXPECT_EQ((Rational(6, 35) * Rational(7, 4)).toString(), "3/10");
+  EXPECT_EQ((Rational(0) * Rational(7, 4)).toString(), "0");
+  EXPECT_EQ((Rational(6, 35) / Rational(-4, 7)).toString(), "-3/10");
+  EXPECT_EQ((Rational(-6, 35) / Rational(-4, 7)).toString(), "3/10");
+
+  const Integer max(std::numeric_limits<int64_t>::max());
+  EXPECT_EQ((Rational(max, 2) + Rational(max, 2)).toString(), "9223372036854775807");
+  EXPECT_EQ((Rational(1, max) + Rational(1, max - 1)).toString(), "18446744073709551613/85070591730234615838173535747377725442");
+  EXPECT_EQ(Rational(max, 3) * Rational(3, max), 1);
+  EXPECT_LT(Rational(1, max), Rational(1, max - 1));
+  EXPECT_GT(Rational(max, max - 1), 1);
+}
+
+TEST(RationalTests, rationalAccumulatorTest) {
+  detail::RationalAccumulator sum;
+  EXPECT_TRUE(sum.isZero());
+  EXPECT_EQ(sum.toRational(), 0);
+
+  for (int64_t i = 1; i <= 10; i++) {
+    sum += Rational(1, i * (i + 1));
+  }
+
+  EXPECT_FALSE(sum.isZero());
+  EXPECT_EQ(sum.toRational().toString(), "10/11");
+
+  sum += Rational(1, 11);
+  EXPECT_EQ(sum.toRational(), 1);
+  EXPECT_EQ(sum.toRational().denominator(), 1);
+
+  detail::RationalAccumulator products;
+  products.addProduct(Rational(2, 3), Rational(3, 4));
+  products.addProduct(Rational(-1, 2), 1);
+  EXPECT_TRUE(products.isZero());
+
+  products.addProduct(3, -4);
+  products += 5;
+  EXPECT_EQ(products.toRational(), -7);
+
+  constexpr std::hash<Rational> hasher;
+  detail::RationalAccumulator halfSum;
+  halfSum += Rational(1, 6);
+  halfSum += Rational(1, 3);
+  EXPECT_EQ(hasher(halfSum.toRational()), hasher(Rational(1, 2)));
+}
+
 TEST(RationalTests, signTest) {
   EXPECT_EQ(Rational(-2).sign(), -1);
   EXPECT_EQ(Rational(-1).sign(), -1);
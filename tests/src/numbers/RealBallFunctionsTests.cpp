@@ -0,0 +1,235 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "fintamath/numbers/RealBallFunctions.hpp"
+
+#include "fintamath/exceptions/UndefinedException.hpp"
+#include "fintamath/numbers/RealFunctions.hpp"
+
+using namespace fintamath;
+
+namespace {
+
+RealBall makeBall(const Rational &mid, const Rational &rad) {
+  return RealBall(Real(mid), Real(rad));
+}
+
+}
+
+TEST(RealBallFunctionsTests, floorTest) {
+  EXPECT_EQ(floor(RealBall(Rational(5, 2))), 2);
+  EXPECT_EQ(floor(RealBall(Rational(-5, 2))), -3);
+  EXPECT_EQ(floor(makeBall(Rational(5, 2), Rational(1, 4))), 2);
+
+  EXPECT_THROW(floor(makeBall(3, Rational(1, 4))), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, ceilTest) {
+  EXPECT_EQ(ceil(RealBall(Rational(5, 2))), 3);
+  EXPECT_EQ(ceil(RealBall(Rational(-5, 2))), -2);
+
+  EXPECT_THROW(ceil(makeBall(3, Rational(1, 4))), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, absTest) {
+  EXPECT_EQ(abs(RealBall(-2)), 2);
+  EXPECT_EQ(abs(makeBall(-3, 1)).getMidpoint(), 3);
+
+  const RealBall ball = abs(makeBall(-1, 2));
+  EXPECT_EQ(ball.getLower(), 0);
+  EXPECT_EQ(ball.getUpper(), 3);
+}
+
+TEST(RealBallFunctionsTests, sqrtTest) {
+  EXPECT_EQ(sqrt(RealBall(4)), 2);
+  EXPECT_TRUE(sqrt(RealBall(2)).contains(sqrt(Real(2))));
+
+  EXPECT_THROW(sqrt(RealBall(-2)), UndefinedException);
+  EXPECT_THROW(sqrt(makeBall(0, 1)), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, powTest) {
+  EXPECT_EQ(pow(RealBall(3), RealBall(4)), 81);
+  EXPECT_EQ(pow(RealBall(-2), RealBall(3)), -8);
+  EXPECT_TRUE(pow(RealBall(2), RealBall(-1)).contains(Real(Rational(1, 2))));
+  EXPECT_TRUE(pow(RealBall(2), RealBall(Rational(1, 2))).contains(sqrt(Real(2))));
+  EXPECT_TRUE(pow(makeBall(-1, 2), RealBall(2)).contains(Real(0)));
+
+  EXPECT_THROW(pow(RealBall(0), RealBall(0)), UndefinedException);
+  EXPECT_THROW(pow(RealBall(0), RealBall(-1)), UndefinedException);
+  EXPECT_THROW(pow(RealBall(-2), RealBall(Rational(1, 2))), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, expTest) {
+  EXPECT_TRUE(exp(RealBall(1)).contains(getE()));
+  EXPECT_TRUE(exp(makeBall(0, 1)).contains(exp(Real(-1))));
+  EXPECT_TRUE(exp(makeBall(0, 1)).contains(getE()));
+}
+
+TEST(RealBallFunctionsTests, logTest) {
+  EXPECT_TRUE(log(RealBall(2), RealBall(8)).contains(Real(3)));
+  EXPECT_TRUE(log(RealBall(3), RealBall(10)).contains(log(Real(3), Real(10))));
+
+  EXPECT_THROW(log(RealBall(1), RealBall(10)), UndefinedException);
+  EXPECT_THROW(log(RealBall(2), RealBall(-10)), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, lnTest) {
+  EXPECT_EQ(ln(RealBall(1)), 0);
+  EXPECT_TRUE(ln(RealBall(10)).contains(ln(Real(10))));
+
+  EXPECT_THROW(ln(RealBall(0)), UndefinedException);
+  EXPECT_THROW(ln(makeBall(1, 2)), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, lbTest) {
+  EXPECT_EQ(lb(RealBall(8)), 3);
+  EXPECT_TRUE(lb(RealBall(10)).contains(lb(Real(10))));
+
+  EXPECT_THROW(lb(RealBall(-1)), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, lgTest) {
+  EXPECT_EQ(lg(RealBall(1000)), 3);
+  EXPECT_TRUE(lg(RealBall(2)).contains(lg(Real(2))));
+
+  EXPECT_THROW(lg(RealBall(-1)), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, sinTest) {
+  EXPECT_TRUE(sin(RealBall(1)).contains(sin(Real(1))));
+  EXPECT_TRUE(sin(makeBall(0, Rational(1, 10))).contains(sin(Real(Rational(1, 10)))));
+  EXPECT_TRUE(sin(makeBall(0, Rational(1, 10))).contains(sin(Real(Rational(-1, 10)))));
+}
+
+TEST(RealBallFunctionsTests, cosTest) {
+  EXPECT_TRUE(cos(RealBall(1)).contains(cos(Real(1))));
+  EXPECT_TRUE(cos(makeBall(1, Rational(1, 2))).contains(cos(Real(Rational(3, 2)))));
+}
+
+TEST(RealBallFunctionsTests, tanTest) {
+  EXPECT_TRUE(tan(RealBall(1)).contains(tan(Real(1))));
+
+  EXPECT_THROW(tan(makeBall(Rational(3, 2), Rational(1, 10))), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, cotTest) {
+  EXPECT_TRUE(cot(RealBall(1)).contains(cot(Real(1))));
+
+  EXPECT_THROW(cot(RealBall(0)), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, secTest) {
+  EXPECT_TRUE(sec(RealBall(1)).contains(sec(Real(1))));
+}
+
+TEST(RealBallFunctionsTests, cscTest) {
+  EXPECT_TRUE(csc(RealBall(1)).contains(csc(Real(1))));
+
+  EXPECT_THROW(csc(RealBall(0)), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, asinTest) {
+  EXPECT_TRUE(asin(RealBall(Rational(1, 2))).contains(asin(Real(Rational(1, 2)))));
+  EXPECT_TRUE(asin(RealBall(1)).contains(getPi() / 2));
+
+  EXPECT_THROW(asin(RealBall(2)), UndefinedException);
+  EXPECT_THROW(asin(makeBall(1, Rational(1, 10))), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, acosTest) {
+  EXPECT_TRUE(acos(RealBall(Rational(1, 2))).contains(acos(Real(Rational(1, 2)))));
+  EXPECT_TRUE(acos(RealBall(-1)).contains(getPi()));
+
+  EXPECT_THROW(acos(RealBall(-2)), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, atanTest) {
+  EXPECT_TRUE(atan(RealBall(1)).contains(getPi() / 4));
+}
+
+TEST(RealBallFunctionsTests, acotTest) {
+  EXPECT_TRUE(acot(RealBall(2)).contains(acot(Real(2))));
+
+  EXPECT_THROW(acot(RealBall(0)), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, asecTest) {
+  EXPECT_TRUE(asec(RealBall(2)).contains(asec(Real(2))));
+
+  EXPECT_THROW(asec(RealBall(Rational(1, 2))), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, acscTest) {
+  EXPECT_TRUE(acsc(RealBall(2)).contains(acsc(Real(2))));
+
+  EXPECT_THROW(acsc(RealBall(Rational(1, 2))), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, sinhTest) {
+  EXPECT_TRUE(sinh(RealBall(1)).contains(sinh(Real(1))));
+}
+
+TEST(RealBallFunctionsTests, coshTest) {
+  EXPECT_TRUE(cosh(RealBall(1)).contains(cosh(Real(1))));
+  EXPECT_TRUE(cosh(RealBall(-1)).contains(cosh(Real(1))));
+
+  const RealBall ball = cosh(makeBall(0, 1));
+  EXPECT_TRUE(ball.contains(Real(1)));
+  EXPECT_TRUE(ball.contains(cosh(Real(1))));
+  EXPECT_GT(ball.getLower(), Real::Backend("0.99"));
+}
+
+TEST(RealBallFunctionsTests, tanhTest) {
+  EXPECT_TRUE(tanh(RealBall(1)).contains(tanh(Real(1))));
+}
+
+TEST(RealBallFunctionsTests, cothTest) {
+  EXPECT_TRUE(coth(RealBall(1)).contains(coth(Real(1))));
+
+  EXPECT_THROW(coth(RealBall(0)), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, sechTest) {
+  EXPECT_TRUE(sech(RealBall(1)).contains(sech(Real(1))));
+}
+
+TEST(RealBallFunctionsTests, cschTest) {
+  EXPECT_TRUE(csch(RealBall(1)).contains(csch(Real(1))));
+
+  EXPECT_THROW(csch(RealBall(0)), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, asinhTest) {
+  EXPECT_TRUE(asinh(RealBall(1)).contains(asinh(Real(1))));
+}
+
+TEST(RealBallFunctionsTests, acoshTest) {
+  EXPECT_TRUE(acosh(RealBall(2)).contains(acosh(Real(2))));
+
+  EXPECT_THROW(acosh(RealBall(Rational(1, 2))), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, atanhTest) {
+  EXPECT_TRUE(atanh(RealBall(Rational(1, 2))).contains(atanh(Real(Rational(1, 2)))));
+
+  EXPECT_THROW(atanh(RealBall(1)), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, acothTest) {
+  EXPECT_TRUE(acoth(RealBall(2)).contains(acoth(Real(2))));
+
+  EXPECT_THROW(acoth(RealBall(Rational(1, 2))), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, asechTest) {
+  EXPECT_TRUE(asech(RealBall(Rational(1, 2))).contains(asech(Real(Rational(1, 2)))));
+
+  EXPECT_THROW(asech(RealBall(2)), UndefinedException);
+}
+
+TEST(RealBallFunctionsTests, acschTest) {
+  EXPECT_TRUE(acsch(RealBall(2)).contains(acsch(Real(2))));
+
+  EXPECT_THROW(acsch(RealBall(0)), UndefinedException);
+}
@@ -0,0 +1,169 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "fintamath/numbers/RealBall.hpp"
+
+#include "fintamath/exceptions/InvalidInputException.hpp"
+#include "fintamath/exceptions/UndefinedException.hpp"
+#include "fintamath/numbers/IntegerFunctions.hpp"
+
+using namespace fintamath;
+
+TEST(RealBallTests, constructorTest) {
+  EXPECT_EQ(RealBall(), 0);
+  EXPECT_EQ(RealBall().getRadius(), 0);
+}
+
+TEST(RealBallTests, integerConstructorTest) {
+  EXPECT_EQ(RealBall(Integer(5)).getMidpoint(), 5);
+  EXPECT_EQ(RealBall(Integer(5)).getRadius(), 0);
+
+  const RealBall ball(pow(Integer(10), 1000));
+  EXPECT_GT(ball.getRadius(), 0);
+  EXPECT_TRUE(ball.contains(Real(pow(Integer(10), 1000))));
+}
+
+TEST(RealBallTests, rationalConstructorTest) {
+  EXPECT_EQ(RealBall(Rational(1, 2)).getMidpoint(), Real::Backend("0.5"));
+  EXPECT_EQ(RealBall(Rational(1, 2)).getRadius(), 0);
+
+  const RealBall ball(Rational(1, 3));
+  EXPECT_GT(ball.getRadius(), 0);
+  EXPECT_TRUE(ball.contains(Real(Rational(1, 3))));
+  EXPECT_LT(ball.getLower() * 3, 1);
+  EXPECT_GT(ball.getUpper() * 3, 1);
+}
+
+TEST(RealBallTests, realConstructorTest) {
+  EXPECT_EQ(RealBall(Real("2.5")).getMidpoint(), Real::Backend("2.5"));
+
+  // 2.5 = 0.625 * 2^2, so one ulp is 2^(2 - precision)
+  const RealBall ball(Real("2.5"));
+  const auto precision = static_cast<int>(mpfr_get_prec(ball.getMidpoint().backend().data()));
+  EXPECT_EQ(ball.getRadius(), boost::multiprecision::ldexp(RealBall::Backend(1), 2 - precision));
+  EXPECT_TRUE(ball.contains(Real("2.5")));
+  EXPECT_GT(RealBall(Real(0)).getRadius(), 0);
+}
+
+TEST(RealBallTests, intConstructorTest) {
+  EXPECT_EQ(RealBall(-3), -3);
+}
+
+TEST(RealBallTests, midpointRadiusConstructorTest) {
+  const RealBall ball(Real(2), Real("0.5"));
+  EXPECT_EQ(ball.getMidpoint(), 2);
+  EXPECT_EQ(ball.getRadius(), Real::Backend("0.5"));
+  EXPECT_EQ(ball.getLower(), Real::Backend("1.5"));
+  EXPECT_EQ(ball.getUpper(), Real::Backend("2.5"));
+
+  EXPECT_THROW(RealBall(Real(2), Real(-1)), InvalidInputException);
+}
+
+TEST(RealBallTests, fromBoundsTest) {
+  const RealBall ball = RealBall::fromBounds(Real::Backend(1), Real::Backend(3));
+  EXPECT_EQ(ball.getMidpoint(), 2);
+  EXPECT_EQ(ball.getRadius(), 1);
+
+  EXPECT_THROW(RealBall::fromBounds(Real::Backend(3), Real::Backend(1)), InvalidInputException);
+}
+
+TEST(RealBallTests, plusOperatorTest) {
+  EXPECT_EQ(RealBall(2) + RealBall(3), 5);
+
+  RealBall sum;
+  for (int i = 0; i < 10; i++) {
+    sum += RealBall(Rational(1, 10));
+  }
+  EXPECT_GT(sum.getRadius(), 0);
+  EXPECT_TRUE(sum.contains(Real(1)));
+
+  const RealBall ball = RealBall(Real(1), Real(1)) + RealBall(Real(2), Real(2));
+  EXPECT_EQ(ball.getMidpoint(), 3);
+  EXPECT_EQ(ball.getRadius(), 3);
+}
+
+TEST(RealBallTests, minusOperatorTest) {
+  EXPECT_EQ(RealBall(2) - RealBall(3), -1);
+
+  const RealBall ball = RealBall(Rational(1, 3)) - RealBall(Rational(1, 3));
+  EXPECT_EQ(ball.getMidpoint(), 0);
+  EXPECT_GT(ball.getRadius(), 0);
+  EXPECT_TRUE(ball.containsZero());
+}
+
+TEST(RealBallTests, multiplyOperatorTest) {
+  EXPECT_EQ(RealBall(2) * RealBall(3), 6);
+
+  const RealBall ball = RealBall(Real(2), Real(1)) * RealBall(Real(3), Real(1));
+  EXPECT_EQ(ball.getMidpoint(), 6);
+  EXPECT_EQ(ball.getRadius(), 6);
+
+  EXPECT_TRUE((RealBall(Rational(1, 3)) * 3).contains(Real(1)));
+}
+
+TEST(RealBallTests, divideOperatorTest) {
+  EXPECT_EQ(RealBall(6) / RealBall(3), 2);
+
+  const RealBall ball = RealBall(1) / RealBall(3);
+  EXPECT_TRUE(ball.contains(Real(Rational(1, 3))));
+
+  EXPECT_TRUE((RealBall(Real(6), Real(1)) / RealBall(Real(3), Real(1))).contains(Real("3.5")));
+
+  EXPECT_THROW(RealBall(1) / RealBall(0), UndefinedException);
+  EXPECT_THROW(RealBall(1) / RealBall(Real(1), Real(2)), UndefinedException);
+}
+
+TEST(RealBallTests, negateOperatorTest) {
+  EXPECT_EQ(-RealBall(5), -5);
+  EXPECT_EQ((-RealBall(Real(1), Real(2))).getRadius(), 2);
+}
+
+TEST(RealBallTests, compareTest) {
+  EXPECT_LT(RealBall(1), RealBall(2));
+  EXPECT_GT(RealBall(Real(1), Real(2)), RealBall(1));
+  EXPECT_NE(RealBall(Real(1), Real(2)), RealBall(1));
+}
+
+TEST(RealBallTests, toStringTest) {
+  EXPECT_EQ(RealBall(5).toString(), "5.0");
+  EXPECT_EQ(RealBall(Real(5), Real("0.25")).toString(), "[5.0 +/- 0.25]");
+  EXPECT_EQ(RealBall(Real(0), Real(1)).toString(), "[0.0 +/- 1.0]");
+}
+
+TEST(RealBallTests, getPrecisionTest) {
+  EXPECT_EQ(RealBall(Real(0), Real(1)).getPrecision(), 0);
+  EXPECT_EQ(RealBall(Real(1000), Real(1)).getPrecision(), 2);
+  EXPECT_EQ(RealBall(Real(1), Real("1e-20")).getPrecision(), 19);
+}
+
+TEST(RealBallTests, signTest) {
+  EXPECT_EQ(RealBall(2).sign(), 1);
+  EXPECT_EQ(RealBall(-2).sign(), -1);
+  EXPECT_EQ(RealBall(0).sign(), 0);
+  EXPECT_EQ(RealBall(Real(1), Real(2)).sign(), 0);
+}
+
+TEST(RealBallTests, containsTest) {
+  const RealBall ball(Real(1), Real(2));
+  EXPECT_TRUE(ball.contains(Real(-1)));
+  EXPECT_TRUE(ball.contains(Real(3)));
+  EXPECT_FALSE(ball.contains(Real(4)));
+  EXPECT_TRUE(ball.containsZero());
+  EXPECT_FALSE(RealBall(Real(3), Real(2)).containsZero());
+}
+
+TEST(RealBallTests, isComplexTest) {
+  EXPECT_FALSE(RealBall(1).isComplex());
+}
+
+TEST(RealBallTests, getClassTest) {
+  EXPECT_EQ(RealBall().getClass()->getName(), "RealBall");
+  EXPECT_EQ(RealBall().getClass()->getParent(), INumber::getClassStatic());
+}
+
+TEST(RealBallTests, hashTest) {
+  constexpr std::hash<RealBall> hasher;
+
+  EXPECT_EQ(hasher(RealBall(1)), hasher(RealBall(1)));
+  EXPECT_NE(hasher(RealBall(1)), hasher(RealBall(Real(1), Real(1))));
+}
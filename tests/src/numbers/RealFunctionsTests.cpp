@@ -4,6 +4,9 @@
 #include "fintamath/core/Cache.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
+#include <optional>
+#include <vector>
+
 #include "fintamath/exceptions/UndefinedException.hpp"
 #include "fintamath/numbers/IntegerFunctions.hpp"
 
@@ -483,6 +486,42 @@ TEST(RealFunctionsTests, powTest) {
             "0.5");
 }
 
+TEST(RealFunctionsTests, powIntegerTest) {
+  Real::ScopedSetPrecision setPrecision(precision);
+
+  EXPECT_EQ(pow(Real("0"), Integer(10)).toString(),
+            "0.0");
+  EXPECT_EQ(pow(Real("1"), Integer(0)).toString(),
+            "1.0");
+  EXPECT_EQ(pow(Real("-1"), Integer("429837493286275623874628734628735")).toString(),
+            "-1.0");
+  EXPECT_EQ(pow(Real("-10"), Integer(3)).toString(),
+            "-1000.0");
+  EXPECT_EQ(pow(Real("2.2"), Integer(5)).toString(),
+            "51.53632");
+  EXPECT_EQ(pow(Real("10"), Integer(10000)).toString(),
+            "1.0*10^10000");
+  EXPECT_EQ(pow(Real("10"), Integer(-10000)).toString(),
+            "1.0*10^-10000");
+  EXPECT_EQ(pow(Real("-10"), Integer(-3)).toString(),
+            "-0.001");
+  EXPECT_EQ(pow(Real("20"), Integer(10000)), pow(Real("20"), Real("10000")));
+  EXPECT_EQ(pow(Real("-2.2"), Integer(-5)), pow(Real("-2.2"), Real("-5")));
+
+  EXPECT_THAT(
+      [] { pow(Real("0"), Integer(0)); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq("pow(0.0, 0) is undefined (zero to the power of zero)")));
+  EXPECT_THAT(
+      [] { pow(Real("0"), Integer(-10)); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq("pow(0.0, -10) is undefined (result overflow)")));
+  EXPECT_THAT(
+      [] { pow(Real("10"), Integer("100000000000000000000")); },
+      testing::ThrowsMessage<UndefinedException>(
+          testing::StrEq("pow(10.0, 100000000000000000000) is undefined (result overflow)")));
+}
+
 TEST(RealFunctionsTests, expTest) {
   Real::ScopedSetPrecision setPrecision(precision);
 
@@ -737,6 +776,11 @@ TEST(RealFunctionsTests, lnTest) {
 }
 
 TEST(RealFunctionsTests, lbTest) {
+  {
+    Real::ScopedSetPrecision setPrecision(10);
+    EXPECT_EQ(lb(Real("1024")).toString(), "10.0");
+  }
+
   Real::ScopedSetPrecision setPrecision(precision);
 
   EXPECT_EQ(lb(Real("1")).toString(),
@@ -817,6 +861,11 @@ TEST(RealFunctionsTests, lbTest) {
 }
 
 TEST(RealFunctionsTests, lgTest) {
+  {
+    Real::ScopedSetPrecision setPrecision(10);
+    EXPECT_EQ(lg(Real("1000")).toString(), "3.0");
+  }
+
   Real::ScopedSetPrecision setPrecision(precision);
 
   EXPECT_EQ(lg(Real("1")).toString(),
@@ -2798,4 +2847,83 @@ TEST(RealFunctionsTests, getPiTest) {
 
   EXPECT_EQ(getPi().toString(),
             "3.1415926535897932384626433832795028841971693993751058209749445923078164062862089986280348253421170679821480865132823066470938446095505822317253594081284811174502841027019385211055596446229489549303819644288109756659334461284756482337867831652712019091456485669234603486104543266482133936072602491412737245870066063155881748815209209628292540917153643678925903600113305305488204665213841469519415116094330572703657595919530921861173819326117931051185480744623799627495673518857527248912279381830119491");
+
+  {
+    // Rounded from the value computed above
+    Real::ScopedSetPrecision setLowPrecision(10);
+    EXPECT_EQ(getPi().toString(), "3.141592654");
+  }
+}
+
+TEST(RealFunctionsTests, getEulerGammaTest) {
+  Real::ScopedSetPrecision setPrecision(50);
+
+  EXPECT_EQ(getEulerGamma().toString(),
+            "0.57721566490153286060651209008240243104215933593992");
+}
+
+TEST(RealFunctionsTests, tryFunctionsTest) {
+  Real::ScopedSetPrecision setPrecision(precision);
+
+  const std::vector<Real> values = {
+      Real(0),
+      Real("-0"),
+      Real("0.5"),
+      Real(1),
+      Real(-1),
+      Real(2),
+      Real(-3),
+      getBottom(),
+      -getBottom(),
+      getTop(),
+      1 / getTop(),
+      getLogBottom(),
+      getLogTop(),
+  };
+
+  const auto expectSameResults = [&values](const auto &func, const auto &tryFunc) {
+    for (const auto &value : values) {
+      std::optional<Real> expected;
+
+      try {
+        expected = func(value);
+      }
+      catch (const UndefinedException &) {
+        // Expected to be undefined
+      }
+
+      const std::optional<Real> res = tryFunc(value);
+      ASSERT_EQ(res.has_value(), expected.has_value());
+
+      if (res) {
+        EXPECT_EQ(res->toString(), expected->toString());
+      }
+    }
+  };
+
+  expectSameResults([](const Real &rhs) { return sqrt(rhs); }, [](const Real &rhs) { return detail::trySqrt(rhs); });
+  expectSameResults([](const Real &rhs) { return pow(rhs, Real("0.5")); }, [](const Real &rhs) { return detail::tryPow(rhs, Real("0.5")); });
+  expectSameResults([](const Real &rhs) { return pow(rhs, Real(0)); }, [](const Real &rhs) { return detail::tryPow(rhs, Real(0)); });
+  expectSameResults([](const Real &rhs) { return pow(rhs, Integer(-3)); }, [](const Real &rhs) { return detail::tryPow(rhs, Integer(-3)); });
+  expectSameResults([](const Real &rhs) { return log(rhs, Real(2)); }, [](const Real &rhs) { return detail::tryLog(rhs, Real(2)); });
+  expectSameResults([](const Real &rhs) { return ln(rhs); }, [](const Real &rhs) { return detail::tryLn(rhs); });
+  expectSameResults([](const Real &rhs) { return lb(rhs); }, [](const Real &rhs) { return detail::tryLb(rhs); });
+  expectSameResults([](const Real &rhs) { return lg(rhs); }, [](const Real &rhs) { return detail::tryLg(rhs); });
+  expectSameResults([](const Real &rhs) { return sin(rhs); }, [](const Real &rhs) { return detail::trySin(rhs); });
+  expectSameResults([](const Real &rhs) { return cot(rhs); }, [](const Real &rhs) { return detail::tryCot(rhs); });
+  expectSameResults([](const Real &rhs) { return asin(rhs); }, [](const Real &rhs) { return detail::tryAsin(rhs); });
+  expectSameResults([](const Real &rhs) { return acot(rhs); }, [](const Real &rhs) { return detail::tryAcot(rhs); });
+  expectSameResults([](const Real &rhs) { return asec(rhs); }, [](const Real &rhs) { return detail::tryAsec(rhs); });
+  expectSameResults([](const Real &rhs) { return sinh(rhs); }, [](const Real &rhs) { return detail::trySinh(rhs); });
+  expectSameResults([](const Real &rhs) { return coth(rhs); }, [](const Real &rhs) { return detail::tryCoth(rhs); });
+  expectSameResults([](const Real &rhs) { return acosh(rhs); }, [](const Real &rhs) { return detail::tryAcosh(rhs); });
+  expectSameResults([](const Real &rhs) { return atanh(rhs); }, [](const Real &rhs) { return detail::tryAtanh(rhs); });
+  expectSameResults([](const Real &rhs) { return acoth(rhs); }, [](const Real &rhs) { return detail::tryAcoth(rhs); });
+  expectSameResults([](const Real &rhs) { return asech(rhs); }, [](const Real &rhs) { return detail::tryAsech(rhs); });
+  expectSameResults([](const Real &rhs) { return tgamma(rhs); }, [](const Real &rhs) { return detail::tryTgamma(rhs); });
+
+  EXPECT_EQ(*detail::tryFloor(Real("-2.5")), -3);
+  EXPECT_EQ(*detail::tryCeil(Real("-2.5")), -2);
+  EXPECT_FALSE(detail::tryFloor(getTop()));
+  EXPECT_FALSE(detail::tryCeil(-getTop()));
 }
@@ -3,6 +3,7 @@
 
 #include "fintamath/numbers/Real.hpp"
 
+#include <thread>
 #include <unordered_set>
 
 #include "fintamath/exceptions/InvalidInputException.hpp"
@@ -1085,6 +1086,38 @@ TEST(RealTests, setPrecisionStaticTest) {
   EXPECT_EQ(Real::getPrecisionStatic(), 20);
 }
 
+TEST(RealTests, setPrecisionStaticThreadTest) {
+  const Real::ScopedSetPrecision setPrecision(10);
+
+  unsigned threadPrecision = 0;
+
+  std::thread([&threadPrecision] {
+    threadPrecision = Real::getPrecisionStatic();
+    Real::setPrecisionStatic(30);
+  }).join();
+
+  EXPECT_EQ(threadPrecision, 20);
+  EXPECT_EQ(Real::getPrecisionStatic(), 10);
+}
+
+TEST(RealTests, setDefaultPrecisionStaticTest) {
+  const unsigned currPrecision = Real::getPrecisionStatic();
+
+  Real::setDefaultPrecisionStatic(30);
+  EXPECT_EQ(Real::getPrecisionStatic(), 30);
+
+  unsigned threadPrecision = 0;
+
+  std::thread([&threadPrecision] {
+    threadPrecision = Real::getPrecisionStatic();
+  }).join();
+
+  EXPECT_EQ(threadPrecision, 30);
+
+  Real::setDefaultPrecisionStatic(currPrecision);
+  EXPECT_EQ(Real::getPrecisionStatic(), 20);
+}
+
 TEST(RealTests, scopedSetPrecisionTest) {
   const unsigned currPrecision = Real::getPrecisionStatic();
 
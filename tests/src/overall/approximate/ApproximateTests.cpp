@@ -562,3 +562,24 @@ TEST(ApproximateTests, approximateWithPrecisionTest) {
     EXPECT_EQ(expr.toString(), "0.3");
   }
 }
+
+TEST(ApproximateTests, approximateAdaptiveTest) {
+  EXPECT_EQ(approximateAdaptive(Expression("sin(E)"), 16).toString(),
+            "0.4107812905029087");
+  EXPECT_EQ(approximateAdaptive(Expression("sin(E)"), 100).toString(),
+            "0.4107812905029086954760094920183605918883069703934153453045716588061351824376549958759786190454355935");
+  EXPECT_EQ(approximateAdaptive(Expression("sqrt(10^40 + 1) - 10^20"), 20).toString(),
+            "5.0*10^-21");
+  EXPECT_EQ(approximateAdaptive(Expression("sin(10^40 E)"), 20).toString(),
+            "-0.98577112928406149203");
+  EXPECT_EQ(approximateAdaptive(Expression("x + sqrt(10^40 + 1) - 10^20"), 10).toString(),
+            "x + 5.0*10^-21");
+  EXPECT_EQ(approximateAdaptive(Expression("sin(x) + E"), 10).toString(),
+            "sin(x) + 2.718281828");
+  EXPECT_EQ(approximateAdaptive(Expression("ln(3) + 5!"), 10).toString(),
+            "121.0986123");
+  EXPECT_EQ(approximateAdaptive(Expression("E/I"), 5).toString(),
+            "-2.7183 I");
+  EXPECT_EQ(approximateAdaptive(Expression("sin(10^1000)"), 10).toString(),
+            "sin(1.0*10^1000)");
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fintamath/expressions/Expression.hpp"
+#include "fintamath/expressions/ExpressionFunctions.hpp"
+#include "fintamath/expressions/SimplifyCache.hpp"
+
+using namespace fintamath;
+
+namespace {
+
+const std::vector<std::string> inputs = {
+    "2 + 3*x - x",
+    "sin(x)^2 + cos(x)^2 + ln(y)*ln(y)",
+    "(x+1)^3 - (x-1)^3",
+    "x^2 - 2x + 1 = 0",
+    "sqrt(2) * 3 / 7 + lb(10) + E^2 - Pi/3",
+    "ln(3) + lg(99) + sin(1) * cos(2)",
+    "derivative(x^3 sin(x), x)",
+};
+
+constexpr size_t threadsCount = 8;
+
+constexpr size_t iterationsCount = 10;
+
+struct ExpectedResult {
+  std::string simplified;
+
+  std::string approximated10;
+
+  std::string approximated30;
+};
+
+std::vector<ExpectedResult> getExpectedResults() {
+  std::vector<ExpectedResult> results;
+
+  for (const auto &input : inputs) {
+    const Expression expr(input);
+    results.emplace_back(expr.toString(),
+                         approximate(expr, 10).toString(),
+                         approximate(expr, 30).toString());
+  }
+
+  return results;
+}
+
+void runThreads(const std::vector<ExpectedResult> &expectedResults) {
+  std::vector<std::thread> threads;
+
+  for (size_t i = 0; i < threadsCount; i++) {
+    threads.emplace_back([&expectedResults, i] {
+      for (size_t j = 0; j < iterationsCount; j++) {
+        for (size_t k = 0; k < inputs.size(); k++) {
+          const Expression expr(inputs[k]);
+          EXPECT_EQ(expr.toString(), expectedResults[k].simplified);
+
+          // Neighbour threads use different precisions at the same time
+          if ((i + j) % 2 == 0) {
+            EXPECT_EQ(approximate(expr, 10).toString(), expectedResults[k].approximated10);
+          }
+          else {
+            EXPECT_EQ(approximate(expr, 30).toString(), expectedResults[k].approximated30);
+          }
+        }
+      }
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+}
+
+TEST(ConcurrencyTests, parseSimplifyApproximateTest) {
+  runThreads(getExpectedResults());
+}
+
+TEST(ConcurrencyTests, simplifyCacheTest) {
+  const std::vector<ExpectedResult> expectedResults = getExpectedResults();
+
+  SimplifyCache::setCapacity(256);
+  runThreads(expectedResults);
+  SimplifyCache::setCapacity(0);
+  SimplifyCache::clear();
+}
+
+TEST(ConcurrencyTests, sharedExpressionTest) {
+  const std::vector<ExpectedResult> expectedResults = getExpectedResults();
+
+  for (size_t k = 0; k < inputs.size(); k++) {
+    // Not simplified yet, so the threads race to simplify it lazily
+    const Expression sharedExpr(inputs[k]);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < threadsCount; i++) {
+      threads.emplace_back([&sharedExpr, &expectedResults, i, k] {
+        if (i % 2 == 0) {
+          EXPECT_EQ(sharedExpr.toString(), expectedResults[k].simplified);
+          EXPECT_EQ(sharedExpr.getChildren().front()->toString(), expectedResults[k].simplified);
+        }
+        else {
+          EXPECT_EQ(sharedExpr.getChildren().front()->toString(), expectedResults[k].simplified);
+          EXPECT_EQ(Expression(sharedExpr).toString(), expectedResults[k].simplified);
+        }
+      });
+    }
+
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+}
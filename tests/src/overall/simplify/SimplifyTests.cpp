@@ -23,6 +23,10 @@ TEST(SimplifyTests, simplifyTest) {
             "1/3");
   EXPECT_EQ(Expression("0 / 3").toString(),
             "0");
+  EXPECT_EQ(Expression("1/2 + x + 1/3 + 1/6").toString(),
+            "x + 1");
+  EXPECT_EQ(Expression("1/2 - 1/3 + x + 1/4 + 2 - 1/5").toString(),
+            "x + 133/60");
   EXPECT_EQ(Expression("2 ^ 2").toString(),
             "4");
   EXPECT_EQ(Expression("-2 ^ 2").toString(),
@@ -373,6 +377,16 @@ TEST(SimplifyTests, simplifyTest) {
             "a^3 + 3 a^2 b + 3 a b^2 + b^3");
   EXPECT_EQ(Expression("(a+b)^4").toString(),
             "a^4 + 4 a^3 b + 6 a^2 b^2 + 4 a b^3 + b^4");
+  EXPECT_EQ(Expression("(x/2+y-1)^3").toString(),
+            "(x^3)/8 + (3 x^2 y)/4 - (3 x^2)/4 + (3 x y^2)/2 - 3 x y + (3 x)/2 + y^3 - 3 y^2 + 3 y - 1");
+  EXPECT_EQ(Expression("(x+1)^10").toString(),
+            "x^10 + 10 x^9 + 45 x^8 + 120 x^7 + 210 x^6 + 252 x^5 + 210 x^4 + 120 x^3 + 45 x^2 + 10 x + 1");
+  EXPECT_EQ(Expression("(x+y)(x-y)(x+2)").toString(),
+            "x^3 + 2 x^2 - x y^2 - 2 y^2");
+  EXPECT_EQ(Expression("(sin(x)+x^2 y)(sin(x)-2/3)").toString(),
+            "sin(x)^2 + x^2 sin(x) y - (2 x^2 y)/3 - (2 sin(x))/3");
+  EXPECT_EQ(Expression("(a+sqrt(2))^4").toString(),
+            "a^4 + 4 a^3 sqrt(2) + 12 a^2 + 8 sqrt(2) a + 4");
   EXPECT_EQ(Expression("5^x 9").toString(),
             "9*5^x");
   EXPECT_EQ(Expression("9 5^x").toString(),